@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Host counterpart of the debugfs "bench" file: runs the driver's
+ * st7305_fb_to_mono() on full frames at every panel geometry, for every
+ * format, pattern and dither type, and prints one line of key=value pairs
+ * per run. -r rotates the framebuffer like the "rotation" property, -b
+ * copies every line through the bounce buffer like write-combined sources.
+ *
+ * With -o DIR it instead writes every pattern as PGM and its black/white
+ * conversion with every dither type as PBM into DIR, for comparing the
+ * algorithms by eye. -i adds a binary PGM, e.g. a photo, to the patterns.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <linux/kernel.h>
+#include <linux/ktime.h>
+#include <linux/string.h>
+#include <drm/drm_fourcc.h>
+#include <drm/drm_rect.h>
+
+#include "dither.h"
+#include "geometry.h"
+#include "st7305-convert.h"
+
+#define BENCH_NS (50 * NSEC_PER_MSEC) // per run, like the debugfs bench
+
+static const u32 formats[] = {
+	DRM_FORMAT_XRGB8888, DRM_FORMAT_R8, DRM_FORMAT_R1,
+};
+static const char * const format_names[] = { "XR24", "R8", "R1" };
+static const char * const patterns[] = { "ramp", "noise" };
+
+static void bench_run(struct st7305_convert *conv, u8 *dst,
+		      const struct st7305_src *src, uint f, int pattern,
+		      u8 type, bool neon)
+{
+	const struct st7305_panel *g = conv->panel;
+	struct drm_rect clip = { 0, 0, g->width, g->height };
+	uint pixels = g->width * g->height;
+	u64 convert_ns = 0, pack_ns = 0;
+	ktime_t start = ktime_get();
+	int frames = 0;
+	s64 ns;
+
+	do {
+		st7305_fb_to_mono(conv, dst, src, &clip, type, neon,
+				  &convert_ns, &pack_ns);
+		frames++;
+		ns = ktime_to_ns(ktime_sub(ktime_get(), start));
+	} while (ns < BENCH_NS);
+
+	printf("panel=%s w=%u h=%u format=%s rot=%u bounce=%d pattern=%s dither=%s neon=%d frames=%d ns_per_frame=%lld convert_ns=%llu pack_ns=%llu ns_per_pixel=%.2f mpix_s=%.3f\n",
+	       g->name, g->width, g->height, format_names[f], src->rotation,
+	       src->bounce, patterns[pattern], dither_get_name(type), neon,
+	       frames, ns / frames, convert_ns / frames, pack_ns / frames,
+	       (double)ns / frames / pixels,
+	       (double)pixels * frames * 1000 / ns);
+}
+
+/* Full frames through st7305_fb_to_mono(), the framebuffer is @rotation */
+static void bench_geometry(const struct st7305_panel *g, uint rotation,
+			   bool bounce, bool neon)
+{
+	uint width = g->width, height = g->height;
+	uint pixels = width * height;
+	u8 *gray = malloc(pixels);
+	u8 *dst = calloc(1, st7305_panel_bufsize(g));
+	struct st7305_src src = {
+		.vaddr = malloc(pixels * 4),
+		.rotation = rotation,
+		.bounce = bounce,
+	};
+	struct st7305_convert conv;
+	int pattern;
+	uint f;
+	u8 type;
+
+	if (rotation == 90 || rotation == 270)
+		swap(width, height);
+
+	st7305_convert_init(NULL, &conv, g);
+
+	for (f = 0; f < ARRAY_SIZE(formats); f++) {
+		src.format = formats[f];
+
+		for (pattern = 0; pattern < ARRAY_SIZE(patterns); pattern++) {
+			st7305_bench_fill(gray, width, height, pattern);
+			src.pitch = st7305_bench_format(src.vaddr, gray, width,
+							height, src.format);
+
+			for (type = 0; type < DITHER_TYPE_MAX; type++)
+				bench_run(&conv, dst, &src, f, pattern, type,
+					  neon);
+		}
+	}
+
+	free(src.vaddr);
+	free(dst);
+	free(gray);
+}
+
+/* Binary PGM with a maxval of 255, comments are not supported */
+static u8 *read_pgm(const char *path, uint *width, uint *height)
+{
+	FILE *fp = fopen(path, "rb");
+	u8 *gray = NULL;
+	uint maxval;
+
+	if (!fp)
+		return NULL;
+
+	if (fscanf(fp, "P5 %u %u %u", width, height, &maxval) == 3 &&
+	    maxval == 255 && fgetc(fp) != EOF) {
+		gray = malloc(*width * *height);
+		if (fread(gray, *width * *height, 1, fp) != 1) {
+			free(gray);
+			gray = NULL;
+		}
+	}
+	fclose(fp);
+
+	return gray;
+}
+
+static int write_image(const char *dir, const char *name, const char *ext,
+		       const char *magic, const u8 *data, uint width,
+		       uint height, size_t size)
+{
+	char path[256];
+	FILE *fp;
+	int ret;
+
+	snprintf(path, sizeof(path), "%s/%s.%s", dir, name, ext);
+	fp = fopen(path, "wb");
+	if (!fp) {
+		perror(path);
+		return 1;
+	}
+	fprintf(fp, "%s\n%u %u\n%s", magic, width, height,
+		magic[1] == '5' ? "255\n" : "");
+	ret = fwrite(data, size, 1, fp) != 1;
+	fclose(fp);
+
+	return ret;
+}
+
+/* @gray as PGM, then the XRGB8888 conversion with every dither type */
+static int write_images(const char *dir, const char *name, const u8 *gray,
+			uint width, uint height)
+{
+	const struct st7305_panel g = { .name = name, .width = width,
+					.height = height };
+	uint pitch = DIV_ROUND_UP(width, 8), x, y;
+	u8 *bw = malloc(width);
+	u8 *pbm = malloc(pitch * height);
+	u32 *src = malloc(width * height * 4);
+	struct st7305_convert conv;
+	char file[128];
+	int ret;
+	u8 type;
+
+	st7305_convert_init(NULL, &conv, &g);
+	st7305_bench_format(src, gray, width, height, DRM_FORMAT_XRGB8888);
+	ret = write_image(dir, name, "pgm", "P5", gray, width, height,
+			  width * height);
+
+	for (type = 0; type < DITHER_TYPE_MAX && !ret; type++) {
+		/* PBM bits are black, 0x00 */
+		memset(pbm, 0, pitch * height);
+		for (y = 0; y < height; y++) {
+			st7305_line_to_bw(&conv, false, type,
+					  DRM_FORMAT_XRGB8888, bw,
+					  src + y * width, 0, y, width);
+			for (x = 0; x < width; x++)
+				if (!bw[x])
+					pbm[y * pitch + x / 8] |= 0x80 >> (x % 8);
+		}
+
+		snprintf(file, sizeof(file), "%s-%s", name,
+			 dither_get_name(type));
+		ret = write_image(dir, file, "pbm", "P4", pbm, width, height,
+				  pitch * height);
+	}
+
+	free(src);
+	free(pbm);
+	free(bw);
+
+	return ret;
+}
+
+static int images(const char *dir, const char *input)
+{
+	/* the largest panels */
+	uint width = 300, height = 400;
+	u8 *gray = malloc(width * height);
+	int pattern, ret = 0;
+
+	for (pattern = 0; pattern < ARRAY_SIZE(patterns) && !ret; pattern++) {
+		st7305_bench_fill(gray, width, height, pattern);
+		ret = write_images(dir, patterns[pattern], gray, width, height);
+	}
+	free(gray);
+
+	if (input && !ret) {
+		gray = read_pgm(input, &width, &height);
+		if (!gray) {
+			fprintf(stderr, "%s: not a binary 8-bit PGM\n", input);
+			return 1;
+		}
+		ret = write_images(dir, "input", gray, width, height);
+		free(gray);
+	}
+
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	const char *dir = NULL, *input = NULL;
+	bool bounce = false;
+	uint i, rotation = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "o:i:r:b")) != -1) {
+		switch (opt) {
+		case 'o':
+			dir = optarg;
+			break;
+		case 'i':
+			input = optarg;
+			break;
+		case 'r':
+			rotation = atoi(optarg);
+			break;
+		case 'b':
+			bounce = true;
+			break;
+		default:
+			fprintf(stderr,
+				"usage: %s [-r 0|90|180|270] [-b] | [-o dir [-i image.pgm]]\n",
+				argv[0]);
+			return 2;
+		}
+	}
+
+	if (dir)
+		return images(dir, input);
+
+	for (i = 0; i < ARRAY_SIZE(panels); i++) {
+		bench_geometry(panels[i], rotation, bounce, false);
+#ifdef CONFIG_KERNEL_MODE_NEON
+		bench_geometry(panels[i], rotation, bounce, true);
+#endif
+	}
+
+	return 0;
+}
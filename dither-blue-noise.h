@@ -0,0 +1,398 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __DITHER_BLUE_NOISE_H
+#define __DITHER_BLUE_NOISE_H
+
+/*
+ * 64x64 blue noise threshold tile, generated offline with void-and-cluster
+ * (Ulichney 1993) on a torus, gaussian sigma 1.5, 10% initial pattern. Each
+ * of the 4096 ranks r is stored as r * 255 / 4096, so gray 0 stays black,
+ * gray 255 stays white and the tile repeats without seams.
+ */
+static const u8 blue_noise64[64][64] = {
+	{ 0xF4, 0x81, 0xA7, 0x49, 0xD5, 0x5F, 0x07, 0x6E, 0x2C, 0xB0, 0x91,
+	  0xDC, 0xAA, 0xEB, 0x80, 0x56, 0xBA, 0x44, 0x6B, 0xBF, 0x57, 0xB1,
+	  0xE3, 0x08, 0x4D, 0x2A, 0xC3, 0x5F, 0x4E, 0xCA, 0xA1, 0x83, 0xF4,
+	  0xBC, 0x40, 0x64, 0xF2, 0x12, 0xD5, 0x84, 0xAB, 0x36, 0x57, 0xB3,
+	  0x6B, 0xD9, 0xC1, 0x0E, 0x83, 0xB6, 0x09, 0xCF, 0xA6, 0x83, 0xC1,
+	  0xF8, 0x29, 0x47, 0xEF, 0x07, 0xAF, 0x86, 0xE3, 0xBF },
+	{ 0x13, 0x63, 0x28, 0xB5, 0x13, 0xFE, 0xA5, 0xBC, 0xE6, 0x40, 0x0F,
+	  0x5D, 0x33, 0xC9, 0x95, 0x25, 0xF5, 0x9E, 0x31, 0x8B, 0xFE, 0x13,
+	  0x63, 0xC8, 0xED, 0x79, 0xD8, 0x0F, 0x91, 0x2D, 0xE7, 0x70, 0x06,
+	  0x5A, 0xDE, 0x8C, 0x75, 0x9A, 0x4D, 0xFA, 0x01, 0x93, 0xC6, 0x13,
+	  0xE7, 0x39, 0x8C, 0xEB, 0x46, 0x31, 0xF5, 0x69, 0x53, 0x35, 0x02,
+	  0x60, 0xAC, 0x13, 0x92, 0xDA, 0x3D, 0x24, 0x66, 0x36 },
+	{ 0x9C, 0xDA, 0x8C, 0xE5, 0x79, 0x37, 0x89, 0x1B, 0x57, 0x81, 0xF0,
+	  0xC1, 0x76, 0x01, 0x64, 0xD2, 0x0C, 0x7C, 0xE0, 0x1A, 0x42, 0xD1,
+	  0x83, 0x3B, 0xA0, 0x17, 0xAA, 0xFB, 0x6C, 0xBB, 0x1A, 0x41, 0xB5,
+	  0x9C, 0x29, 0x1A, 0xC2, 0x3A, 0xB6, 0x2B, 0x61, 0xEB, 0x44, 0x81,
+	  0xA2, 0x53, 0x21, 0xAE, 0x73, 0xC8, 0x8D, 0x1B, 0xB3, 0xED, 0x96,
+	  0xD4, 0x7D, 0xC2, 0x69, 0x53, 0xA3, 0xFD, 0x7B, 0xB3 },
+	{ 0xC4, 0x43, 0x16, 0x58, 0xC2, 0x4B, 0xDF, 0x6A, 0x9F, 0xD1, 0x23,
+	  0x98, 0x48, 0xFC, 0xB4, 0x42, 0xA6, 0x52, 0xC8, 0xAA, 0x72, 0x96,
+	  0x26, 0xBE, 0x55, 0x69, 0x27, 0x45, 0x81, 0xDF, 0x56, 0x8B, 0xCF,
+	  0x6A, 0xFE, 0x51, 0xD7, 0x08, 0x6F, 0xCD, 0xA5, 0x75, 0x23, 0xD1,
+	  0x0B, 0xF0, 0x68, 0xD4, 0x01, 0x5C, 0xA3, 0x42, 0xD6, 0x6D, 0x22,
+	  0x4C, 0x3B, 0xF4, 0x2B, 0xC8, 0x19, 0xD1, 0x03, 0x54 },
+	{ 0x22, 0x72, 0xF8, 0xA3, 0x00, 0x95, 0x29, 0xC7, 0x06, 0x39, 0x6C,
+	  0xB9, 0x17, 0x7E, 0x2F, 0x88, 0xEE, 0x13, 0x63, 0x2D, 0xEA, 0x50,
+	  0xD9, 0x0A, 0xF5, 0x93, 0xCE, 0xB4, 0x01, 0x32, 0xA9, 0xEF, 0x0D,
+	  0x34, 0xAF, 0x83, 0xA5, 0xE8, 0x8E, 0x52, 0x10, 0xDD, 0x98, 0x60,
+	  0xB0, 0x7B, 0x40, 0x91, 0xF9, 0x24, 0xE5, 0x7D, 0x13, 0x8F, 0xBA,
+	  0xE2, 0xA6, 0x19, 0x9C, 0x86, 0x6E, 0x4B, 0x96, 0xEF },
+	{ 0xD3, 0x92, 0x33, 0xCC, 0x6B, 0xEC, 0xB4, 0x54, 0xE3, 0xA7, 0xF4,
+	  0x53, 0xD4, 0xA2, 0xDF, 0x59, 0x23, 0xD7, 0x7A, 0xBC, 0x02, 0xA3,
+	  0x6D, 0xB0, 0x80, 0x35, 0xE3, 0x59, 0x9E, 0xCC, 0x66, 0x25, 0x7D,
+	  0xDA, 0x43, 0x15, 0x5F, 0x24, 0x3F, 0xF4, 0xBE, 0x36, 0x4D, 0xFE,
+	  0x2E, 0xC3, 0x17, 0xA8, 0x36, 0xBA, 0x4E, 0xCA, 0x39, 0xFE, 0x55,
+	  0x0B, 0x77, 0x62, 0xDB, 0x39, 0xEB, 0xAE, 0x31, 0x83 },
+	{ 0x09, 0x5C, 0xAC, 0x1F, 0x85, 0x3D, 0x16, 0x73, 0x87, 0x45, 0x0D,
+	  0x8D, 0x2B, 0x66, 0x09, 0xC3, 0x94, 0xAE, 0x45, 0x87, 0xFA, 0x3E,
+	  0x21, 0xE8, 0x49, 0x11, 0x78, 0x1F, 0xF7, 0x47, 0x91, 0xBD, 0x4F,
+	  0x99, 0xC0, 0xED, 0x76, 0xD1, 0xA0, 0x83, 0x1F, 0x7A, 0xB6, 0x04,
+	  0x8B, 0xE1, 0x54, 0xD0, 0x81, 0x64, 0x96, 0x06, 0xAD, 0x65, 0x2A,
+	  0x89, 0xD0, 0xB0, 0x05, 0x5A, 0xBF, 0x11, 0xDF, 0x65 },
+	{ 0xBB, 0xE4, 0x46, 0xF0, 0x57, 0xD9, 0xAB, 0xF6, 0x2E, 0xD6, 0xC2,
+	  0x76, 0xEB, 0xB6, 0x3F, 0xF8, 0x6D, 0x31, 0xE2, 0x1A, 0x5A, 0xD0,
+	  0x91, 0x5E, 0xC8, 0x9A, 0xB8, 0x63, 0x86, 0x0B, 0xDE, 0x19, 0xF8,
+	  0x6C, 0x02, 0x8C, 0x32, 0xB5, 0x0B, 0x5B, 0xE2, 0x9B, 0xCF, 0x6B,
+	  0x41, 0xA0, 0x72, 0x0A, 0xDE, 0x1D, 0xF4, 0x77, 0xDA, 0x9A, 0xBD,
+	  0xE7, 0x34, 0x4A, 0xFA, 0x90, 0x29, 0x7B, 0x47, 0xA0 },
+	{ 0x3A, 0x81, 0x10, 0xB7, 0x9B, 0x0C, 0x65, 0x96, 0x1E, 0x5F, 0x9E,
+	  0x14, 0x4C, 0x99, 0x1F, 0x82, 0x51, 0x06, 0xC7, 0x9B, 0xB4, 0x77,
+	  0x0D, 0xAA, 0x2A, 0xF4, 0x40, 0xDA, 0x30, 0xAF, 0x75, 0x3D, 0xA4,
+	  0x28, 0x5A, 0xD7, 0x4C, 0xFB, 0x6C, 0xC6, 0x3E, 0x12, 0x56, 0xE7,
+	  0x1D, 0xF5, 0x2C, 0xB5, 0x48, 0xA4, 0x31, 0x59, 0x1F, 0x47, 0x0E,
+	  0x6D, 0xA0, 0x1F, 0xC5, 0x6F, 0xA7, 0xF2, 0xCB, 0x23 },
+	{ 0xFC, 0xC5, 0x5F, 0x75, 0x28, 0xC4, 0x48, 0xCF, 0x7F, 0xB8, 0xFC,
+	  0x32, 0xE1, 0x6B, 0xD6, 0xC0, 0xAA, 0xF1, 0x71, 0x4B, 0x25, 0xEF,
+	  0x3A, 0xDC, 0x7F, 0x69, 0x05, 0xC2, 0x96, 0xF0, 0x5D, 0xCD, 0x85,
+	  0xEA, 0xC4, 0xA9, 0x1C, 0x95, 0x2C, 0xA7, 0xF1, 0x74, 0x2F, 0xAE,
+	  0x80, 0xC0, 0x61, 0x91, 0xE7, 0x7E, 0xCD, 0xB2, 0xE9, 0x84, 0xC8,
+	  0xF5, 0x59, 0x81, 0xDD, 0x3B, 0x14, 0x51, 0x8D, 0x6B },
+	{ 0x19, 0x8F, 0x32, 0xDC, 0xF7, 0x89, 0x30, 0xEE, 0x04, 0x3D, 0x58,
+	  0x8C, 0xB1, 0x01, 0x58, 0x33, 0x14, 0x8C, 0x38, 0xE4, 0x94, 0x67,
+	  0xBC, 0x53, 0x18, 0xD5, 0x8C, 0x58, 0x21, 0x49, 0x10, 0xB5, 0x34,
+	  0x0A, 0x7B, 0x3E, 0x72, 0xE4, 0x54, 0x03, 0x8D, 0xBB, 0xD8, 0x95,
+	  0x4A, 0x07, 0xD7, 0x3A, 0x0E, 0x66, 0x18, 0x40, 0x91, 0x63, 0x37,
+	  0x1C, 0xB5, 0x06, 0x98, 0x65, 0xB7, 0xE1, 0x01, 0xAB },
+	{ 0x52, 0xD4, 0xA6, 0x49, 0x08, 0x6B, 0xB1, 0x53, 0xA1, 0xD8, 0x74,
+	  0x1D, 0xCD, 0x7C, 0xF7, 0x94, 0xDC, 0x5E, 0xBE, 0x16, 0xD4, 0x09,
+	  0x86, 0xFD, 0x9C, 0x33, 0xAC, 0xE9, 0x7C, 0xD4, 0x9B, 0x67, 0xDE,
+	  0x52, 0x9B, 0xF3, 0x15, 0xBF, 0x7E, 0xDD, 0x48, 0x20, 0x5C, 0x13,
+	  0xF0, 0x77, 0x9F, 0x54, 0xFA, 0xC1, 0x9D, 0xEF, 0x00, 0xD9, 0xA6,
+	  0x75, 0xCD, 0x4B, 0xEF, 0x2D, 0xD1, 0x75, 0x44, 0xEA },
+	{ 0x28, 0x78, 0x14, 0xB9, 0x97, 0xD3, 0x1D, 0x7B, 0xC0, 0x13, 0xEC,
+	  0x9A, 0x47, 0x27, 0xA7, 0x3F, 0x76, 0x23, 0xA4, 0x7F, 0x58, 0xA9,
+	  0x45, 0x26, 0xCA, 0x73, 0x42, 0x0D, 0xBE, 0x30, 0xFB, 0x1D, 0x88,
+	  0xBB, 0x25, 0xCF, 0x63, 0xAD, 0x38, 0xC9, 0x6B, 0xF8, 0x87, 0xA9,
+	  0x38, 0xC6, 0x25, 0xAF, 0x88, 0x2E, 0x73, 0x57, 0xBA, 0x2A, 0x50,
+	  0x8E, 0xE3, 0x24, 0xAD, 0x56, 0x94, 0x1C, 0x88, 0xC1 },
+	{ 0xA1, 0xF6, 0x67, 0xDF, 0x58, 0x38, 0xE6, 0x94, 0x40, 0x68, 0x30,
+	  0xB6, 0xDE, 0x64, 0xC1, 0x0E, 0xCE, 0xE8, 0x48, 0xF7, 0x2F, 0xBA,
+	  0xE5, 0x62, 0x01, 0xB4, 0xF2, 0x65, 0x93, 0x4F, 0x74, 0xAD, 0x3B,
+	  0xEE, 0x70, 0x4C, 0x0B, 0x98, 0x26, 0x90, 0x0E, 0xB1, 0x2E, 0xD2,
+	  0x6D, 0xE4, 0x62, 0x16, 0xE1, 0x4A, 0xD1, 0x1F, 0x7D, 0xFE, 0xB0,
+	  0x0B, 0x3C, 0x6C, 0x85, 0x09, 0xFB, 0xB3, 0x35, 0x5D },
+	{ 0x08, 0x8D, 0x3E, 0x26, 0x81, 0xC4, 0x62, 0x0F, 0xF1, 0xCC, 0x90,
+	  0x5B, 0x0A, 0x85, 0xED, 0x4F, 0x9C, 0x69, 0x03, 0xC6, 0x70, 0x1A,
+	  0x8F, 0x7A, 0xDD, 0x51, 0x87, 0x17, 0xCA, 0xA4, 0x0F, 0xD8, 0x59,
+	  0x00, 0xA3, 0x86, 0xFE, 0xD3, 0x58, 0xED, 0x41, 0xE2, 0x54, 0x80,
+	  0x02, 0x46, 0x95, 0xB8, 0x78, 0x06, 0xA6, 0xE3, 0x97, 0x41, 0x69,
+	  0xC2, 0xF3, 0xA0, 0xDA, 0xBF, 0x48, 0x6D, 0xE2, 0xD0 },
+	{ 0x4D, 0xC5, 0xEA, 0xA5, 0x05, 0xFE, 0x2C, 0xAF, 0x4E, 0x78, 0x22,
+	  0xFA, 0x3C, 0xAF, 0x1F, 0x79, 0x31, 0xB7, 0x8C, 0x3B, 0x9D, 0xF2,
+	  0x3F, 0xC7, 0x2D, 0xA1, 0x3A, 0xD7, 0x29, 0xE8, 0x42, 0x8D, 0xC0,
+	  0xE6, 0x33, 0xB5, 0x40, 0x1C, 0x7A, 0xBA, 0x70, 0x96, 0x17, 0xA3,
+	  0xFD, 0xBF, 0x33, 0xF2, 0x59, 0xC0, 0x38, 0x65, 0x11, 0xCB, 0x1D,
+	  0x83, 0x5A, 0x18, 0x35, 0x63, 0x24, 0xA4, 0x12, 0x7E },
+	{ 0xB2, 0x1F, 0x74, 0x51, 0xB8, 0x8A, 0x71, 0x9A, 0xDE, 0x02, 0xBA,
+	  0x9F, 0x6E, 0xD8, 0x93, 0xC3, 0xFC, 0x1B, 0xE0, 0x61, 0xCF, 0x09,
+	  0x59, 0x97, 0x0F, 0xF9, 0xBB, 0x7B, 0x55, 0x6E, 0xB7, 0x21, 0x67,
+	  0x7F, 0x15, 0xC9, 0x65, 0xE4, 0xA8, 0x04, 0x33, 0xD7, 0xC7, 0x28,
+	  0x5B, 0x71, 0x0D, 0x84, 0x23, 0xD8, 0x8D, 0xED, 0x4F, 0xAB, 0xE7,
+	  0x2F, 0xD6, 0xB9, 0x7E, 0xEC, 0xCB, 0x8A, 0xF3, 0x30 },
+	{ 0x66, 0x92, 0xD3, 0x18, 0xE3, 0x3F, 0x1C, 0xC1, 0x34, 0x86, 0x49,
+	  0xE6, 0x2D, 0x54, 0x05, 0x42, 0x63, 0xA8, 0x50, 0x26, 0xB1, 0x80,
+	  0xE2, 0xAF, 0x71, 0x61, 0x1C, 0x91, 0xF1, 0x08, 0x9A, 0xFA, 0x39,
+	  0xD1, 0x4F, 0x91, 0x2A, 0x9A, 0x4B, 0xF6, 0x65, 0x88, 0x48, 0xB2,
+	  0xDA, 0x98, 0xE6, 0xAD, 0x41, 0x9F, 0x0A, 0x7E, 0x27, 0x6E, 0x90,
+	  0x48, 0x9C, 0x02, 0x53, 0x97, 0x15, 0x3E, 0x58, 0xD8 },
+	{ 0x00, 0xF9, 0x37, 0x60, 0xA0, 0x6A, 0xD2, 0x55, 0xF6, 0x66, 0xD0,
+	  0x16, 0x80, 0xC8, 0xED, 0x73, 0xD6, 0x0C, 0x88, 0xEF, 0x6C, 0x1D,
+	  0x4A, 0x26, 0xEA, 0xCA, 0x48, 0xAC, 0x31, 0xD1, 0x47, 0x84, 0x0C,
+	  0xA0, 0xF0, 0x71, 0xDA, 0x10, 0x7E, 0xBD, 0x24, 0xE2, 0x0A, 0x77,
+	  0x38, 0x1B, 0x4F, 0xCE, 0x6F, 0xF8, 0x5C, 0xB8, 0xD0, 0xF6, 0x0B,
+	  0xB4, 0x6C, 0xFA, 0x39, 0xDB, 0xB0, 0x78, 0xBD, 0x9B },
+	{ 0x48, 0xAC, 0x83, 0xC7, 0x0A, 0xF3, 0x8F, 0x10, 0xA8, 0x24, 0x97,
+	  0xB6, 0x5F, 0xA4, 0x25, 0xB5, 0x98, 0x31, 0xC5, 0x3D, 0xDA, 0x94,
+	  0xC0, 0x85, 0x3B, 0x9C, 0x04, 0xE2, 0x5E, 0x75, 0xC0, 0xDE, 0x57,
+	  0xB1, 0x22, 0x42, 0xB3, 0x5C, 0xD0, 0x3B, 0x90, 0xAD, 0x53, 0xEB,
+	  0x87, 0xC1, 0x67, 0x11, 0x31, 0xC2, 0x20, 0x45, 0x89, 0x37, 0x5C,
+	  0xDE, 0x21, 0xC2, 0x87, 0x2A, 0x68, 0x0C, 0xE8, 0x28 },
+	{ 0x76, 0xE6, 0x23, 0x4E, 0xB1, 0x2C, 0x46, 0xBB, 0x75, 0xE9, 0x43,
+	  0x0D, 0xF8, 0x37, 0x87, 0x12, 0x53, 0xF3, 0x78, 0xA5, 0x02, 0x57,
+	  0xFE, 0x10, 0xD9, 0x5B, 0x7B, 0xC4, 0x22, 0xA8, 0x12, 0x2B, 0x6E,
+	  0xE8, 0x8A, 0x05, 0xFA, 0x9D, 0x18, 0xE8, 0x60, 0x19, 0xC4, 0x9F,
+	  0x29, 0xF7, 0xA5, 0x8E, 0xE9, 0x7A, 0x98, 0xE0, 0x15, 0xA5, 0xC7,
+	  0x7B, 0x43, 0xA2, 0x5F, 0xC9, 0xF5, 0x91, 0x52, 0xCE },
+	{ 0x16, 0x63, 0xD8, 0x99, 0x72, 0xEA, 0x82, 0xDC, 0x30, 0x59, 0x89,
+	  0xDA, 0x71, 0x4F, 0xD2, 0xE4, 0x6A, 0xBA, 0x16, 0x60, 0xD3, 0x30,
+	  0xB3, 0x76, 0xA7, 0x2D, 0xF7, 0x8C, 0x3E, 0xEB, 0x86, 0x9C, 0x3A,
+	  0xCC, 0x63, 0xC3, 0x79, 0x34, 0x51, 0xA7, 0x7C, 0xFC, 0x3F, 0x6B,
+	  0x00, 0x5A, 0x3A, 0xD8, 0x4B, 0x06, 0xAF, 0x57, 0x73, 0xF1, 0x2D,
+	  0x95, 0x14, 0xEA, 0x06, 0x49, 0x1E, 0xAA, 0x35, 0x88 },
+	{ 0xA2, 0xBA, 0x05, 0x3B, 0xCD, 0x19, 0x56, 0x03, 0xA3, 0xC9, 0x19,
+	  0xBB, 0xA0, 0x00, 0xAC, 0x3F, 0x27, 0x8C, 0x43, 0xE8, 0x7F, 0x98,
+	  0x44, 0x60, 0x1B, 0xCF, 0x4E, 0x0F, 0xB9, 0x66, 0x4E, 0xF4, 0xAA,
+	  0x17, 0x4D, 0x2A, 0xE2, 0x8E, 0xC0, 0x05, 0xD1, 0x2D, 0x94, 0xDF,
+	  0xCC, 0xB3, 0x76, 0x22, 0xB9, 0x65, 0xFC, 0x3C, 0xBA, 0x01, 0x4D,
+	  0xE3, 0xBF, 0x72, 0xB2, 0x82, 0xDB, 0x6C, 0xC6, 0xF2 },
+	{ 0x56, 0x43, 0xFE, 0x86, 0x5F, 0xA7, 0xC3, 0x93, 0x6B, 0xFC, 0x3B,
+	  0x62, 0x2B, 0xF3, 0x75, 0x95, 0xCB, 0xFB, 0xA3, 0x22, 0xC7, 0x0B,
+	  0xDC, 0xF3, 0xBB, 0x92, 0x6A, 0xA3, 0xDD, 0x1F, 0xC3, 0x01, 0x78,
+	  0xDB, 0x95, 0xAE, 0x69, 0x1C, 0xF3, 0x6D, 0x48, 0xB2, 0x0F, 0x82,
+	  0x46, 0x15, 0xED, 0x86, 0xCD, 0x19, 0x8F, 0x28, 0xCF, 0x9A, 0x82,
+	  0x67, 0x1F, 0x55, 0xFD, 0x37, 0x99, 0x5A, 0x09, 0x29 },
+	{ 0xDD, 0x70, 0x96, 0x27, 0xE4, 0x35, 0xF3, 0x47, 0x26, 0xAE, 0x7F,
+	  0xD1, 0x8F, 0x58, 0xC0, 0x1A, 0x5D, 0x05, 0x70, 0x50, 0xAF, 0x67,
+	  0x28, 0x84, 0x3A, 0x03, 0xEE, 0x43, 0x7E, 0x34, 0x92, 0xD4, 0x59,
+	  0x2E, 0xF8, 0x09, 0xD2, 0x58, 0x37, 0xA1, 0xE9, 0x77, 0x5B, 0xF4,
+	  0xA6, 0x61, 0x97, 0x35, 0x54, 0xA7, 0xDD, 0x7C, 0x5D, 0xEB, 0x32,
+	  0xD8, 0xA9, 0x92, 0x26, 0xD2, 0x19, 0xEC, 0xBC, 0x7F },
+	{ 0xA9, 0x0D, 0xCB, 0xB3, 0x11, 0x6E, 0x87, 0x0E, 0xE2, 0x50, 0x08,
+	  0xEE, 0x16, 0x3D, 0xE9, 0x30, 0xDC, 0x83, 0xC1, 0x32, 0xF1, 0x90,
+	  0xCC, 0x55, 0xAB, 0x79, 0xD5, 0x18, 0xB5, 0xFD, 0x6D, 0x42, 0xB6,
+	  0x89, 0x70, 0x3F, 0x9C, 0xB8, 0x85, 0x24, 0xCA, 0x18, 0xBD, 0x34,
+	  0x24, 0xC3, 0xD9, 0x0A, 0xF1, 0x6C, 0x40, 0x0C, 0xAF, 0x18, 0xBC,
+	  0x44, 0x0A, 0xCB, 0x4D, 0x79, 0xB1, 0x47, 0x8E, 0x38 },
+	{ 0xF0, 0x64, 0x33, 0x7D, 0x4F, 0xBF, 0xD5, 0xA5, 0x79, 0xCA, 0x95,
+	  0x6C, 0xB8, 0x9D, 0x79, 0xB0, 0x48, 0xA6, 0xE3, 0x18, 0x7A, 0x3E,
+	  0x0E, 0xEB, 0x1D, 0xC6, 0x5E, 0x9C, 0x52, 0x08, 0xA6, 0x23, 0xED,
+	  0x15, 0xC4, 0x53, 0xEC, 0x10, 0xD8, 0x63, 0x8D, 0x43, 0x9E, 0xDD,
+	  0x8C, 0x71, 0x44, 0xB7, 0x82, 0x23, 0xBE, 0xF5, 0x93, 0x55, 0x72,
+	  0xF6, 0x89, 0x65, 0xE6, 0x9E, 0x00, 0x6F, 0xD6, 0x1E },
+	{ 0xC0, 0x4C, 0xD4, 0xED, 0xA0, 0x20, 0x3E, 0x5D, 0x2F, 0xB5, 0x40,
+	  0x22, 0xE0, 0x52, 0x07, 0xD0, 0x67, 0x0F, 0x96, 0x57, 0xD2, 0x9D,
+	  0xBC, 0x64, 0x93, 0x40, 0x26, 0xE4, 0x89, 0xC5, 0xE0, 0x61, 0x9B,
+	  0x37, 0xDF, 0x90, 0x28, 0x7A, 0x3C, 0xFB, 0x03, 0xE4, 0x69, 0x51,
+	  0x08, 0xFE, 0x1C, 0x5E, 0xA1, 0xD6, 0x4F, 0x76, 0x26, 0xE4, 0x9D,
+	  0x2D, 0xB2, 0x1B, 0x3B, 0xC3, 0x2D, 0xF7, 0x5E, 0x9B },
+	{ 0x84, 0x26, 0x8D, 0x02, 0x61, 0xDD, 0x91, 0xFB, 0x19, 0xE7, 0x65,
+	  0xD2, 0x86, 0x2E, 0xFB, 0x8E, 0x26, 0xEE, 0x3B, 0x6D, 0xFD, 0x24,
+	  0x4A, 0xDC, 0x75, 0xF7, 0xB7, 0x70, 0x36, 0x1D, 0x7A, 0x45, 0xBD,
+	  0x7D, 0x05, 0xA8, 0x68, 0xC9, 0xB0, 0x50, 0xA6, 0xC4, 0x1F, 0x7F,
+	  0xCF, 0xAA, 0x94, 0xE1, 0x32, 0x06, 0x8F, 0xC6, 0x3B, 0xCE, 0x03,
+	  0x4C, 0xD9, 0x7B, 0xF1, 0x54, 0x83, 0xB8, 0x41, 0x0E },
+	{ 0x71, 0xF9, 0xB0, 0x43, 0xC2, 0x78, 0x0B, 0xB1, 0x6E, 0x9F, 0x02,
+	  0x4B, 0xA5, 0x72, 0xB9, 0x44, 0xAD, 0x81, 0xCA, 0xB7, 0x08, 0x82,
+	  0xB3, 0x2F, 0x05, 0x9E, 0x16, 0x49, 0xF0, 0x98, 0xD0, 0x10, 0xFA,
+	  0x55, 0xD3, 0x44, 0xF5, 0x13, 0x8E, 0x25, 0x79, 0x38, 0xF4, 0xB8,
+	  0x3D, 0x27, 0x6D, 0x4D, 0xBA, 0xF9, 0x66, 0x14, 0xA8, 0x5D, 0x86,
+	  0xBF, 0x61, 0xA4, 0x0C, 0x96, 0xDF, 0x17, 0xA9, 0xCF },
+	{ 0x36, 0x58, 0x15, 0x9B, 0xF2, 0x33, 0x53, 0xCC, 0x3D, 0x84, 0xF5,
+	  0xC0, 0x1C, 0xEB, 0x11, 0x5F, 0xDC, 0x1A, 0x4E, 0x2F, 0xA4, 0x56,
+	  0xE8, 0x8C, 0xCA, 0x56, 0xD8, 0x85, 0xBD, 0x5E, 0x2E, 0xAE, 0x6B,
+	  0x26, 0x85, 0xB8, 0x2F, 0x5D, 0xE6, 0xCF, 0x61, 0x99, 0x0F, 0x90,
+	  0x5C, 0xED, 0xC9, 0x15, 0x7F, 0x9D, 0x44, 0xEC, 0x79, 0xDF, 0x17,
+	  0xFB, 0x39, 0x25, 0xCB, 0x69, 0x29, 0x77, 0x4F, 0xE5 },
+	{ 0xA0, 0xBD, 0xDD, 0x6C, 0x20, 0x88, 0xE6, 0x96, 0x25, 0xD7, 0x5A,
+	  0x30, 0x92, 0x68, 0xCB, 0x35, 0x9E, 0x78, 0xF5, 0x8E, 0xD7, 0x68,
+	  0x1A, 0x3D, 0xAB, 0x69, 0x33, 0xA8, 0x02, 0xDB, 0x4C, 0x8B, 0xE4,
+	  0xA3, 0x18, 0xE1, 0x71, 0xA1, 0x45, 0x0B, 0xB4, 0xE0, 0x4B, 0xD6,
+	  0x74, 0x00, 0x89, 0xE5, 0x3B, 0x21, 0xD1, 0xB2, 0x2E, 0x49, 0xA1,
+	  0x6F, 0x8F, 0xEC, 0xAF, 0x47, 0xD3, 0xFD, 0x92, 0x04 },
+	{ 0x67, 0x24, 0x81, 0x4E, 0xD5, 0xAD, 0x12, 0x63, 0xBE, 0x0E, 0x79,
+	  0xB2, 0xE0, 0x4A, 0x87, 0xE7, 0x04, 0x65, 0xC2, 0x14, 0x42, 0xBF,
+	  0xF2, 0x7A, 0xE0, 0x10, 0xFB, 0x72, 0x27, 0x7C, 0xF4, 0x0B, 0x36,
+	  0xCB, 0x5A, 0x95, 0x01, 0xBF, 0x7E, 0xF9, 0x30, 0x6B, 0x1E, 0xB1,
+	  0x32, 0xA3, 0x52, 0xAD, 0xC4, 0x74, 0x59, 0x05, 0x8A, 0xC8, 0x22,
+	  0xB8, 0x10, 0x59, 0x7F, 0x07, 0xA1, 0x60, 0x30, 0xC6 },
+	{ 0x44, 0xE3, 0x97, 0x06, 0xC0, 0x40, 0x7A, 0xF7, 0x4B, 0xA2, 0xED,
+	  0x40, 0x07, 0xA6, 0x23, 0xBD, 0x45, 0xAC, 0x2B, 0xE9, 0x74, 0x01,
+	  0x99, 0x26, 0x4D, 0xBD, 0x8A, 0x47, 0xCD, 0xB0, 0x9B, 0x63, 0xB6,
+	  0x79, 0x45, 0xEB, 0x38, 0xD3, 0x1F, 0x57, 0x8B, 0xA4, 0xF0, 0x81,
+	  0xC6, 0xFA, 0x28, 0x64, 0x0B, 0xF5, 0x96, 0xDC, 0x67, 0xF2, 0x56,
+	  0xE7, 0x42, 0xC5, 0xE3, 0x36, 0xBD, 0x19, 0x7C, 0xEF },
+	{ 0x10, 0xB2, 0x37, 0xFC, 0x62, 0x23, 0xA5, 0xCB, 0x32, 0x6D, 0x20,
+	  0x8B, 0xC9, 0x74, 0x58, 0xFA, 0x7F, 0xD4, 0x5B, 0xA3, 0x8B, 0x55,
+	  0xB2, 0xD3, 0x64, 0x9F, 0x1F, 0xDE, 0x58, 0x14, 0x3C, 0xD5, 0x21,
+	  0xF8, 0x0F, 0xB0, 0x88, 0x67, 0xAB, 0xDB, 0xC4, 0x13, 0x3C, 0x5E,
+	  0x0E, 0x46, 0x93, 0xD7, 0x81, 0x4A, 0x30, 0xAA, 0x3C, 0x12, 0x9E,
+	  0x76, 0x93, 0x28, 0x65, 0x8A, 0xF2, 0x4C, 0xA9, 0x8C },
+	{ 0x6E, 0x53, 0xCE, 0x73, 0x8F, 0xE7, 0x56, 0x00, 0x87, 0xB9, 0xDB,
+	  0x5E, 0xF3, 0x34, 0xB4, 0x18, 0x94, 0x0D, 0x39, 0xDC, 0x21, 0xFC,
+	  0x31, 0x85, 0x0C, 0xF1, 0x38, 0xB7, 0x94, 0x6D, 0xEE, 0x85, 0x51,
+	  0x92, 0xC7, 0x5E, 0x29, 0xF4, 0x3E, 0x07, 0x4E, 0x78, 0xD3, 0x97,
+	  0xDF, 0x77, 0xBC, 0x14, 0xB1, 0xE9, 0x1B, 0xCA, 0x84, 0xBF, 0x2B,
+	  0xDA, 0x00, 0xAB, 0xCF, 0x12, 0x71, 0xD9, 0x21, 0xC9 },
+	{ 0xE6, 0xA4, 0x28, 0x11, 0xB8, 0x33, 0xD5, 0x9B, 0xEB, 0x15, 0x4F,
+	  0xAA, 0x0F, 0x99, 0xDF, 0x41, 0x63, 0xEC, 0x70, 0xB5, 0x4B, 0xC5,
+	  0x6F, 0xE0, 0x41, 0xC8, 0x7B, 0x07, 0xE6, 0x2C, 0xC4, 0x03, 0xA9,
+	  0x2E, 0x72, 0xD8, 0x12, 0x9D, 0x73, 0x93, 0xEB, 0xA8, 0x29, 0xB9,
+	  0x51, 0x25, 0xF3, 0x3D, 0x5A, 0x9E, 0x76, 0x51, 0xFD, 0x6C, 0x4A,
+	  0xB7, 0x5D, 0xF9, 0x4D, 0xA0, 0x3E, 0xB4, 0x5E, 0x35 },
+	{ 0x05, 0x80, 0xF2, 0x99, 0x4A, 0x84, 0x1A, 0x68, 0x43, 0x7D, 0xD0,
+	  0x39, 0x6F, 0x25, 0x7D, 0xD1, 0xA8, 0xC1, 0x1E, 0x82, 0x0A, 0x9F,
+	  0x19, 0x59, 0xAA, 0x96, 0x68, 0x4D, 0x87, 0xA3, 0x46, 0x62, 0xBC,
+	  0xE3, 0x40, 0xA5, 0x55, 0xBC, 0xE5, 0x2E, 0x5D, 0x16, 0xFC, 0x68,
+	  0x04, 0xA7, 0x87, 0x6D, 0xCF, 0x2B, 0xDE, 0x16, 0x99, 0x0A, 0xE9,
+	  0x87, 0x33, 0x7E, 0x1E, 0xE9, 0x8D, 0x0D, 0xFB, 0x95 },
+	{ 0xBE, 0x5F, 0x40, 0xDA, 0xC1, 0x5E, 0xF6, 0xC7, 0xB2, 0x2A, 0xFD,
+	  0x88, 0xC6, 0xEE, 0x55, 0x02, 0x2C, 0x4C, 0x97, 0xF0, 0x61, 0xD7,
+	  0x8A, 0xF4, 0x2A, 0x13, 0xD5, 0xFE, 0x20, 0xCC, 0x74, 0xF6, 0x1C,
+	  0x80, 0x0B, 0xFE, 0x8A, 0x1B, 0x49, 0xCA, 0xAF, 0x8B, 0x41, 0x7E,
+	  0xE5, 0xC8, 0x36, 0xE2, 0x08, 0x8B, 0xBD, 0x63, 0x36, 0xA9, 0xC7,
+	  0x1B, 0xA2, 0xCC, 0x66, 0xBD, 0x2C, 0x7C, 0xCE, 0x4A },
+	{ 0xE1, 0xAC, 0x1C, 0x71, 0x07, 0xA7, 0x2C, 0x77, 0x0D, 0x9D, 0x61,
+	  0x07, 0x4A, 0xB6, 0xA1, 0x8A, 0xFB, 0x77, 0xD4, 0x3C, 0xBD, 0x2E,
+	  0x46, 0xB1, 0x77, 0xBF, 0x32, 0x5F, 0xB3, 0x0D, 0xD9, 0x39, 0x9C,
+	  0x52, 0xC6, 0x6A, 0x36, 0xDE, 0x7F, 0x02, 0x6E, 0xDC, 0xBF, 0x2D,
+	  0x93, 0x5C, 0x14, 0x9C, 0x53, 0xAD, 0x41, 0xF0, 0xD2, 0x73, 0x59,
+	  0x41, 0xEC, 0x10, 0x45, 0xDF, 0x56, 0xAB, 0x68, 0x18 },
+	{ 0x2B, 0x79, 0xC9, 0x34, 0xEA, 0x92, 0x47, 0xE5, 0x56, 0xDA, 0xC0,
+	  0x92, 0xE4, 0x1B, 0x35, 0x67, 0xC4, 0x16, 0x5C, 0x06, 0xA6, 0x7A,
+	  0xE5, 0x0C, 0x54, 0xE0, 0x9D, 0x7F, 0x44, 0x98, 0x2B, 0x89, 0xB6,
+	  0xEC, 0x23, 0xAC, 0xD0, 0x62, 0x9F, 0xF7, 0x27, 0x55, 0x0C, 0xA8,
+	  0x49, 0xF0, 0xBB, 0x7B, 0xF8, 0x20, 0x80, 0x02, 0x8D, 0x25, 0xE1,
+	  0x91, 0x6A, 0xB3, 0x82, 0x97, 0x04, 0xEA, 0x3A, 0x8F },
+	{ 0xA0, 0x53, 0xFA, 0x8B, 0x5A, 0xD2, 0x11, 0xAC, 0x85, 0x1E, 0x42,
+	  0x2E, 0x7A, 0x5C, 0xDB, 0xAE, 0x43, 0xE4, 0xB4, 0x92, 0xF7, 0x1E,
+	  0x64, 0xCE, 0x90, 0x3F, 0x00, 0xE8, 0xC9, 0x6E, 0xEF, 0x5C, 0x04,
+	  0x6F, 0x45, 0x95, 0x09, 0x2B, 0xB7, 0x41, 0xC6, 0x98, 0xE8, 0xCF,
+	  0x1A, 0x6B, 0x29, 0x44, 0xC9, 0x6E, 0xE4, 0xB4, 0x4F, 0xBF, 0x0D,
+	  0xAB, 0x2B, 0xF8, 0x36, 0xD0, 0x22, 0xB9, 0x70, 0xF2 },
+	{ 0xBC, 0x01, 0x42, 0xB5, 0x17, 0x7B, 0xBE, 0x33, 0xF9, 0x64, 0xB1,
+	  0xF2, 0xA0, 0xC8, 0x09, 0x93, 0x20, 0x84, 0x31, 0x6F, 0x4A, 0xC7,
+	  0xA2, 0x29, 0xFA, 0x71, 0xAD, 0x27, 0x50, 0x11, 0xA9, 0x3F, 0xC4,
+	  0xD7, 0x7F, 0xE1, 0x5B, 0xEE, 0x8B, 0x14, 0x7C, 0x65, 0x37, 0x78,
+	  0x8C, 0xB0, 0xD6, 0x9E, 0x0E, 0x34, 0x5B, 0x9F, 0x2F, 0xF4, 0x7C,
+	  0x53, 0xC5, 0x09, 0x60, 0x76, 0xA2, 0x4E, 0xD5, 0x15 },
+	{ 0x82, 0xE6, 0x6D, 0xA4, 0x2A, 0xE1, 0x50, 0x6F, 0x9E, 0x01, 0xD6,
+	  0x6D, 0x15, 0x45, 0xE9, 0x6A, 0xF6, 0x52, 0xCF, 0xE1, 0x12, 0x83,
+	  0x3A, 0xBA, 0x5B, 0x17, 0xD7, 0x83, 0xF6, 0xBC, 0x7B, 0xE5, 0x27,
+	  0x9B, 0x18, 0x37, 0xBB, 0x73, 0x49, 0xDB, 0xA9, 0xF2, 0x21, 0x4E,
+	  0xFB, 0x01, 0x5B, 0xED, 0x8B, 0xB9, 0xD2, 0x12, 0x6C, 0xD5, 0x3A,
+	  0x9D, 0xE6, 0x88, 0xDB, 0x41, 0xF0, 0x86, 0x30, 0x61 },
+	{ 0x3D, 0x21, 0xC3, 0xDA, 0x62, 0x9A, 0xEE, 0x23, 0xCB, 0x8A, 0x50,
+	  0x27, 0x8E, 0xB9, 0x7F, 0x39, 0xA5, 0x00, 0x98, 0x27, 0x61, 0xEE,
+	  0x94, 0x06, 0x7C, 0xC3, 0x49, 0x9A, 0x5E, 0x36, 0x19, 0x8D, 0x64,
+	  0xB3, 0x52, 0xFA, 0x9D, 0x0E, 0xCE, 0x2D, 0x57, 0x07, 0xB8, 0x9F,
+	  0xC5, 0x3E, 0x80, 0x22, 0x4C, 0x73, 0xFD, 0x44, 0x8A, 0xAD, 0x15,
+	  0x66, 0x21, 0x4A, 0xB7, 0x19, 0xAE, 0x0C, 0x9D, 0xCC },
+	{ 0xAF, 0x8E, 0x4E, 0x0F, 0x3C, 0x84, 0x09, 0x47, 0xB7, 0x38, 0xEA,
+	  0xA8, 0xD3, 0x57, 0x12, 0xD9, 0xC4, 0x5D, 0xBB, 0x7B, 0xAC, 0xCC,
+	  0x4F, 0xDF, 0xA5, 0xF1, 0x2F, 0x1C, 0xD4, 0xA3, 0xDE, 0x47, 0xF3,
+	  0x07, 0xD2, 0x84, 0x25, 0x60, 0xB1, 0x93, 0xE3, 0x84, 0xD4, 0x60,
+	  0x2C, 0x95, 0xE1, 0xCD, 0xAB, 0x05, 0x98, 0x27, 0xE1, 0x50, 0xBF,
+	  0xFA, 0x79, 0xCE, 0x97, 0x2F, 0x67, 0xDC, 0x4C, 0xF9 },
+	{ 0x12, 0xEB, 0x7A, 0xA0, 0xFD, 0xCD, 0xAC, 0x74, 0xD9, 0x60, 0x1A,
+	  0x76, 0x34, 0xFD, 0x99, 0x24, 0x77, 0x34, 0xF0, 0x47, 0x0E, 0x32,
+	  0x73, 0x23, 0x3F, 0x68, 0x92, 0xB8, 0x74, 0x03, 0x6A, 0xC8, 0x2B,
+	  0x94, 0x6E, 0x41, 0xC2, 0xEA, 0x77, 0x3C, 0x1B, 0x6A, 0x3F, 0x16,
+	  0xE9, 0x72, 0x11, 0x65, 0x35, 0xE7, 0x5C, 0xC7, 0x78, 0x0B, 0x8E,
+	  0x31, 0xA5, 0x04, 0x5A, 0xF6, 0xBC, 0x7E, 0x27, 0x71 },
+	{ 0x38, 0x5A, 0xC6, 0x2E, 0x6E, 0x1E, 0x55, 0x8F, 0x12, 0xF4, 0x85,
+	  0xC5, 0x04, 0x69, 0xB3, 0x4D, 0xE3, 0x90, 0x1B, 0xD7, 0x9C, 0xFD,
+	  0xBB, 0x8F, 0xCE, 0x09, 0xE1, 0x51, 0xF8, 0x3C, 0xAF, 0x83, 0x56,
+	  0xAA, 0xE8, 0x12, 0xA2, 0x4E, 0x01, 0xF5, 0xBE, 0x99, 0xEF, 0x88,
+	  0xAE, 0xC0, 0x51, 0x9C, 0xBA, 0x84, 0x19, 0xB2, 0x3C, 0xEF, 0x62,
+	  0xD8, 0x46, 0xE3, 0x74, 0x3D, 0x91, 0x06, 0xC5, 0x97 },
+	{ 0xDA, 0xA7, 0x09, 0xDE, 0xB9, 0x3F, 0xEF, 0xB4, 0x32, 0x9E, 0x46,
+	  0xB0, 0xE2, 0x3E, 0x84, 0xCB, 0x08, 0x64, 0xB0, 0x81, 0x51, 0x68,
+	  0x17, 0xE7, 0x5A, 0xAE, 0x7F, 0x15, 0x8A, 0xC5, 0x23, 0xE0, 0x0F,
+	  0x37, 0xCC, 0x62, 0x2D, 0xD6, 0x8A, 0xAA, 0x59, 0x2B, 0xC9, 0x4B,
+	  0x04, 0x3A, 0xF8, 0x23, 0xDB, 0x42, 0xF6, 0x6A, 0xA1, 0xCE, 0x22,
+	  0xB3, 0x12, 0x86, 0xC2, 0x1B, 0xE0, 0x4F, 0xF1, 0x64 },
+	{ 0x1E, 0x81, 0x4C, 0x94, 0x5F, 0x86, 0x02, 0xE0, 0x65, 0xC9, 0x24,
+	  0x58, 0x90, 0x1C, 0xF1, 0x2C, 0x9E, 0xF8, 0x3D, 0xCA, 0x04, 0xB4,
+	  0x3B, 0x82, 0x1E, 0x43, 0xC1, 0x31, 0xE6, 0x4A, 0x98, 0x5F, 0xF5,
+	  0x75, 0xB6, 0x8D, 0xFC, 0x6F, 0x1F, 0x43, 0xDD, 0x0C, 0x7A, 0xA4,
+	  0x6E, 0xD1, 0x8D, 0x78, 0x09, 0x56, 0x96, 0x2D, 0x03, 0x80, 0x52,
+	  0x93, 0x67, 0xED, 0x2B, 0xB0, 0x62, 0x9F, 0x2E, 0xB3 },
+	{ 0xCE, 0xF8, 0x2C, 0xE9, 0x19, 0xD5, 0xA3, 0x4A, 0x7D, 0x0F, 0xF9,
+	  0x73, 0xD6, 0xA9, 0x5E, 0x75, 0xBE, 0x55, 0x1F, 0x72, 0xEA, 0x90,
+	  0xD1, 0xA8, 0xF5, 0x72, 0xD8, 0x5F, 0xA9, 0x71, 0x06, 0xD4, 0x87,
+	  0x24, 0x46, 0x17, 0x54, 0xB1, 0xC8, 0x7D, 0x9F, 0x61, 0xFB, 0x20,
+	  0xE0, 0x59, 0x2F, 0xAC, 0xCD, 0x6E, 0xC3, 0xDC, 0x47, 0xE5, 0xBC,
+	  0x37, 0xCC, 0xA1, 0x49, 0x7D, 0xD4, 0x10, 0x88, 0x46 },
+	{ 0x03, 0x67, 0xAF, 0x74, 0xB7, 0x38, 0x6F, 0x20, 0xD2, 0xAC, 0x96,
+	  0x34, 0x07, 0x4B, 0xCE, 0x11, 0x37, 0x8A, 0xDC, 0x9F, 0x2F, 0x4C,
+	  0x10, 0x60, 0x2B, 0x9C, 0x0B, 0x8F, 0x1D, 0xFE, 0xB2, 0x39, 0xC1,
+	  0xA4, 0xEC, 0xD4, 0x9B, 0x39, 0x0F, 0xF2, 0x30, 0xCD, 0xB6, 0x3D,
+	  0x95, 0xB9, 0x16, 0xE6, 0x39, 0x9F, 0x13, 0x83, 0xAC, 0x70, 0x0F,
+	  0xFD, 0x1E, 0x5B, 0x01, 0xF7, 0x38, 0xBA, 0xE5, 0x76 },
+	{ 0xC3, 0x36, 0x97, 0x0C, 0x50, 0xFB, 0xC2, 0x90, 0xE8, 0x3F, 0x61,
+	  0xEC, 0xC1, 0x7D, 0x92, 0xEE, 0xAD, 0xC9, 0x15, 0x5B, 0xBC, 0xF9,
+	  0x76, 0xDA, 0xBE, 0x4E, 0xEF, 0xC8, 0x48, 0x2C, 0x7E, 0x50, 0x11,
+	  0x5C, 0x70, 0x03, 0x82, 0xE8, 0x69, 0x95, 0x4E, 0x14, 0x88, 0x53,
+	  0x08, 0xEE, 0x66, 0x85, 0x4C, 0xF5, 0x29, 0x5D, 0xEE, 0x31, 0xA2,
+	  0x89, 0x6A, 0xDF, 0xAD, 0x94, 0x6F, 0x1D, 0x54, 0xA2 },
+	{ 0xF3, 0x5A, 0xE7, 0xCB, 0x8B, 0x29, 0x60, 0x07, 0x56, 0x28, 0x82,
+	  0xB0, 0x1D, 0x3E, 0xDE, 0x29, 0x6A, 0x45, 0x7D, 0xE4, 0x21, 0x89,
+	  0x40, 0xA2, 0x18, 0x80, 0x37, 0x6A, 0xB6, 0xD7, 0x9D, 0xEE, 0xCB,
+	  0x8E, 0x35, 0xB9, 0x4C, 0xCD, 0x2A, 0xC0, 0x77, 0xE8, 0xAB, 0x6B,
+	  0xD3, 0x34, 0xA6, 0xC8, 0x00, 0xD6, 0x91, 0xBD, 0x1D, 0x57, 0xDB,
+	  0x45, 0xC4, 0x82, 0x25, 0x4D, 0xCF, 0xEB, 0x8E, 0x27 },
+	{ 0x13, 0x82, 0x44, 0x1E, 0xAD, 0x7C, 0xEC, 0x9D, 0xB6, 0xCA, 0x0E,
+	  0xDB, 0x6F, 0x9F, 0x5B, 0x06, 0xA4, 0xF7, 0x0D, 0xA8, 0x68, 0xB3,
+	  0x00, 0xF1, 0x5D, 0x96, 0xE6, 0x05, 0x89, 0x5B, 0x16, 0x6C, 0x26,
+	  0xE2, 0xA6, 0xF8, 0x1C, 0x60, 0xA9, 0x08, 0xD9, 0x3B, 0x25, 0xF3,
+	  0x7B, 0x92, 0x1E, 0x58, 0x79, 0xAB, 0x69, 0x41, 0xD2, 0x8F, 0x07,
+	  0xAA, 0x16, 0x39, 0xF0, 0xB5, 0x11, 0x66, 0x3F, 0xB4 },
+	{ 0xDB, 0x9F, 0x69, 0xDF, 0x35, 0xD0, 0x17, 0x44, 0x75, 0xF5, 0x8E,
+	  0x4D, 0x2E, 0xFD, 0xBA, 0x86, 0xD3, 0x56, 0x90, 0x3C, 0xCD, 0x50,
+	  0xD5, 0x34, 0xC6, 0x22, 0xD3, 0xA7, 0x28, 0xF4, 0x42, 0xBA, 0x80,
+	  0x48, 0x0E, 0x78, 0x97, 0xDF, 0x42, 0x8A, 0x55, 0xA1, 0xCA, 0x0C,
+	  0x46, 0xC3, 0xFC, 0x3E, 0xE7, 0x30, 0x10, 0xF9, 0x7C, 0xB5, 0x63,
+	  0xF6, 0x76, 0xD1, 0x59, 0x8A, 0x33, 0xA7, 0xCC, 0x74 },
+	{ 0x2C, 0xC5, 0x0A, 0xA6, 0x54, 0x6D, 0xB2, 0xDC, 0x20, 0x35, 0x5F,
+	  0xA9, 0xD5, 0x14, 0x43, 0x70, 0x32, 0x1D, 0xBE, 0xE9, 0x2A, 0x98,
+	  0x7E, 0x6B, 0xAF, 0x45, 0x73, 0x51, 0xC1, 0x7A, 0xDD, 0x00, 0x9B,
+	  0xD4, 0x5D, 0xC5, 0x28, 0x6F, 0xBC, 0xFE, 0x1A, 0x6A, 0x90, 0x5D,
+	  0xAE, 0x18, 0x64, 0xB7, 0x87, 0xCA, 0x54, 0xA4, 0x1A, 0x35, 0xE2,
+	  0x24, 0x48, 0x9E, 0x05, 0xC1, 0x78, 0xFC, 0x08, 0x55 },
+	{ 0x89, 0x3E, 0xF9, 0x90, 0xEA, 0x03, 0x8B, 0x5C, 0x9A, 0xBD, 0xE7,
+	  0x00, 0x7D, 0x93, 0xC5, 0xEF, 0xA8, 0xDD, 0x75, 0x5E, 0x08, 0xFD,
+	  0x1E, 0xE1, 0x0A, 0x8D, 0xF9, 0x14, 0x94, 0x34, 0xAA, 0x64, 0xF6,
+	  0x31, 0xAE, 0x3F, 0xEF, 0x04, 0x32, 0x7C, 0xAA, 0xEC, 0x2F, 0xD7,
+	  0x84, 0xE0, 0x9D, 0x28, 0x0A, 0x99, 0xDD, 0x73, 0xC3, 0x51, 0x9B,
+	  0x85, 0xBB, 0xED, 0x62, 0xDB, 0x22, 0x4B, 0x97, 0xE5 },
+	{ 0xB9, 0x5A, 0x72, 0x24, 0x45, 0xC2, 0x33, 0xFC, 0x0D, 0x49, 0x6F,
+	  0xCC, 0x3C, 0x62, 0x20, 0x50, 0x04, 0x8B, 0x46, 0xAE, 0x87, 0xB9,
+	  0x49, 0xA1, 0x5F, 0xBB, 0x38, 0xD6, 0x61, 0xCB, 0x20, 0x4B, 0x8C,
+	  0x18, 0x7C, 0xD8, 0x8D, 0xA1, 0x5C, 0xCF, 0x47, 0x09, 0xB7, 0x4F,
+	  0x11, 0x38, 0x77, 0xF1, 0x48, 0x67, 0x20, 0x3A, 0xEF, 0x02, 0xD0,
+	  0x6B, 0x10, 0x2F, 0x92, 0x3F, 0xA5, 0xD0, 0x69, 0x1B },
+	{ 0xEE, 0x0E, 0xD5, 0xBB, 0x81, 0xD9, 0x74, 0xA7, 0xD2, 0x83, 0x1C,
+	  0x98, 0xF2, 0xAF, 0xDF, 0x9A, 0x69, 0xCA, 0x13, 0xEF, 0x2D, 0x70,
+	  0xD6, 0x33, 0xEB, 0x1F, 0x81, 0xA2, 0x0D, 0xE4, 0x77, 0xB7, 0xE7,
+	  0xC7, 0x66, 0x11, 0x4E, 0xBF, 0xEA, 0x1D, 0x8B, 0xE0, 0x75, 0x97,
+	  0xF7, 0xBB, 0x54, 0xCD, 0xA6, 0xE5, 0xB6, 0x7E, 0x94, 0x5E, 0xAD,
+	  0x40, 0xDE, 0x7C, 0xB5, 0x13, 0xE9, 0x82, 0x32, 0xAB },
+	{ 0x7B, 0x99, 0x35, 0xA2, 0x11, 0x60, 0x1A, 0x52, 0x2A, 0xEC, 0xB2,
+	  0x57, 0x2C, 0x0F, 0x7A, 0x31, 0xB5, 0xE5, 0x3C, 0x9E, 0xC2, 0x58,
+	  0x0D, 0x91, 0x78, 0xC7, 0x44, 0xF0, 0x52, 0x8F, 0x3C, 0x07, 0x57,
+	  0x2A, 0xA3, 0xFA, 0x26, 0x71, 0x3A, 0xB2, 0x66, 0x29, 0xC8, 0x3D,
+	  0x68, 0x21, 0x8E, 0x03, 0x32, 0x85, 0x14, 0x4D, 0xD9, 0x2D, 0xFE,
+	  0x1C, 0xC3, 0x4A, 0xF6, 0x6A, 0x52, 0x00, 0xC7, 0x46 },
+	{ 0x20, 0xE1, 0x68, 0x4D, 0xF6, 0xB1, 0xE2, 0x93, 0xC2, 0x66, 0x3E,
+	  0xC7, 0x88, 0xD5, 0x4B, 0xFB, 0x5B, 0x25, 0x80, 0x68, 0x1A, 0xF3,
+	  0xAC, 0xCE, 0x51, 0x02, 0xAB, 0x71, 0x2C, 0xC4, 0xFC, 0x99, 0xD9,
+	  0x80, 0x43, 0xB4, 0x89, 0xE2, 0x0B, 0x99, 0xF7, 0x52, 0xA5, 0x06,
+	  0xE8, 0xAE, 0xD7, 0x70, 0xC5, 0x5C, 0xF3, 0xBE, 0x0C, 0xA4, 0x76,
+	  0x8C, 0x5B, 0xA2, 0x22, 0x8E, 0xBE, 0xA1, 0xF9, 0x62 },
+	{ 0x8F, 0xB6, 0x04, 0xC9, 0x88, 0x30, 0x41, 0x7D, 0x15, 0xA2, 0x05,
+	  0xF7, 0x6C, 0xA0, 0xBE, 0x08, 0x91, 0xAB, 0xCE, 0x4B, 0xD9, 0x85,
+	  0x42, 0x21, 0xF9, 0x66, 0xDE, 0x1B, 0xB4, 0x7D, 0x62, 0x20, 0xAE,
+	  0x6C, 0xE9, 0x03, 0x54, 0xCD, 0x7E, 0x43, 0xBE, 0x14, 0x86, 0xD0,
+	  0x4C, 0x80, 0x36, 0xFC, 0x1E, 0x9E, 0x3D, 0x8F, 0x64, 0xCB, 0x39,
+	  0xE3, 0x0A, 0xD3, 0x36, 0xE5, 0x1B, 0x72, 0x2E, 0xD3 },
+	{ 0x57, 0x3A, 0xEA, 0x73, 0x21, 0x9A, 0xC6, 0xF1, 0x4F, 0xD6, 0x79,
+	  0x27, 0x50, 0x17, 0x3B, 0xDD, 0x74, 0x1D, 0xEC, 0x03, 0x9C, 0x2F,
+	  0x72, 0x99, 0xB8, 0x89, 0x3A, 0x9A, 0xED, 0x0A, 0x46, 0xD2, 0x37,
+	  0x17, 0x95, 0xC6, 0x2F, 0xA8, 0x5F, 0x22, 0xDB, 0x6F, 0xF1, 0x2A,
+	  0x9A, 0x17, 0x60, 0xA7, 0x50, 0xDD, 0x75, 0x2A, 0xEA, 0x1A, 0x4F,
+	  0x9B, 0x70, 0xB8, 0x7F, 0x5D, 0xCC, 0x49, 0x9A, 0x0C }
+};
+
+#endif /* __DITHER_BLUE_NOISE_H */
@@ -5,21 +5,56 @@
  * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
  */
 
+#include <linux/device.h>
 #include <linux/kernel.h>
+#include <linux/slab.h>
+#include <linux/string.h>
 
 #include "dither.h"
+#include "dither-blue-noise.h"
+#include "st7305-neon.h"
+
+/*
+ * Error diffusion kernel, weights in 1/2^shift of the pixel error for the
+ * neighbours right (r1, r2), below (dl, d, dr) and two lines below (d2).
+ */
+struct dither_ed_kernel {
+	u8 shift;
+	u8 r1, r2;
+	u8 dl, d, dr;
+	u8 d2;
+};
 
 struct dither {
 	u8 idx;
 	const char *name;
-	void (*algo)(const u8 *src, u8 *dst, int width, int height);
+
+	/* ordered threshold matrix, @order x @order, rows contiguous */
+	const u8 *matrix;
+	u8 order;
+
+	/* error diffusion, stateful, lines must come in order */
+	const struct dither_ed_kernel *ed;
 };
 
-#define DEFINE_DITHER(i, n, func)                 \
-	{                                         \
-		.idx = i, .name = n, .algo = func \
+#define DEFINE_DITHER(i, n, m)                                   \
+	{                                                        \
+		.idx = i, .name = n, .matrix = &m[0][0],         \
+		.order = ARRAY_SIZE(m)                           \
+	}
+
+/* The stateless line helpers fall back to a plain threshold for these */
+#define DEFINE_DIFFUSION(i, n, k)                                    \
+	{                                                            \
+		.idx = i, .name = n, .matrix = &threshold_none[0][0], \
+		.order = 1, .ed = &k                                 \
 	}
 
+/* Without dithering a pixel is lit from mid-gray up, i.e. gray >> 7 */
+static const u8 threshold_none[1][1] = {
+	{ 0x7F },
+};
+
 static const u8 bayer4x4[4][4] = {
 	{ 0x00, 0x80, 0x20, 0xA0 },
 	{ 0xC0, 0x40, 0xE0, 0x60 },
@@ -27,20 +62,6 @@ static const u8 bayer4x4[4][4] = {
 	{ 0xF0, 0x70, 0xD0, 0x50 },
 };
 
-static void __maybe_unused bayer_dither_4x4_gray8_to_bw(const u8 *src, u8 *dst,
-							int width, int height)
-{
-	int x, y, idx;
-	u8 threshold;
-	for (y = 0; y < height; y++) {
-		for (x = 0; x < width; x++) {
-			idx = y * width + x;
-			threshold = bayer4x4[y & 0x03][x & 0x03];
-			dst[idx] = (src[idx] > threshold) ? 0xFF : 0x00;
-		}
-	}
-}
-
 static const u8 bayer16x16[16][16] = {
 	{ 0x00, 0x80, 0x20, 0xA0, 0x08, 0x88, 0x28, 0xA8, 0x02, 0x82, 0x22,
 	  0xA2, 0x0A, 0x8A, 0x2A, 0xAA },
@@ -76,27 +97,40 @@ static const u8 bayer16x16[16][16] = {
 	  0x5D, 0xF5, 0x75, 0xD5, 0x55 }
 };
 
-static void __maybe_unused bayer_dither_16x16_gray8_to_bw(const u8 *src,
-							  u8 *dst, int width,
-							  int height)
-{
-	int x, y, idx;
-	u8 threshold;
-	for (y = 0; y < height; y++) {
-		for (x = 0; x < width; x++) {
-			idx = y * width + x;
-			threshold = bayer16x16[y & 0x0F][x & 0x0F];
-			dst[idx] = (src[idx] > threshold) ? 0xFF : 0x00;
-		}
-	}
-}
+/*
+ *        X   7
+ *    3   5   1     (1/16)
+ */
+static const struct dither_ed_kernel floyd_steinberg = {
+	.shift = 4, .r1 = 7, .dl = 3, .d = 5, .dr = 1,
+};
+
+/*
+ *        X   1   1
+ *    1   1   1         (1/8, 2/8 of the error is dropped)
+ *        1
+ */
+static const struct dither_ed_kernel atkinson = {
+	.shift = 3, .r1 = 1, .r2 = 1, .dl = 1, .d = 1, .dr = 1, .d2 = 1,
+};
+
+/*
+ *        X   2
+ *    1   1         (1/4)
+ */
+static const struct dither_ed_kernel sierra_lite = {
+	.shift = 2, .r1 = 2, .dl = 1, .d = 1,
+};
 
 static const struct dither supported_ditherings[] = {
-	{ /* Reserved*/ },
-	DEFINE_DITHER(DITHER_TYPE_BAYER_4X4, "bayer4x4",
-		      bayer_dither_4x4_gray8_to_bw),
-	DEFINE_DITHER(DITHER_TYPE_BAYER_16X16, "bayer16x16",
-		      bayer_dither_16x16_gray8_to_bw),
+	DEFINE_DITHER(DITHER_TYPE_NONE, "none", threshold_none),
+	DEFINE_DITHER(DITHER_TYPE_BAYER_4X4, "bayer4x4", bayer4x4),
+	DEFINE_DITHER(DITHER_TYPE_BAYER_16X16, "bayer16x16", bayer16x16),
+	DEFINE_DIFFUSION(DITHER_TYPE_FLOYD_STEINBERG, "floyd-steinberg",
+			 floyd_steinberg),
+	DEFINE_DIFFUSION(DITHER_TYPE_ATKINSON, "atkinson", atkinson),
+	DEFINE_DIFFUSION(DITHER_TYPE_SIERRA_LITE, "sierra-lite", sierra_lite),
+	DEFINE_DITHER(DITHER_TYPE_BLUE_NOISE, "blue-noise", blue_noise64),
 	{}
 };
 
@@ -112,14 +146,291 @@ const char *dither_get_name(u8 type)
 }
 EXPORT_SYMBOL(dither_get_name);
 
-void dither_gray8_to_bw(u8 type, const u8 *src, u8 *dst, int width, int height)
+/* ITU BT.601, same weights as drm_fb_xrgb8888_to_gray8() */
+static inline u8 xrgb8888_to_luma(u32 pix)
 {
-	if (unlikely(type >= DITHER_TYPE_MAX))
-		return;
+	u32 r = (pix >> 16) & 0xFF;
+	u32 g = (pix >> 8) & 0xFF;
+	u32 b = pix & 0xFF;
+
+	return (3 * r + 6 * g + b) / 10;
+}
+
+bool dither_is_diffusion(u8 type)
+{
+	return type < DITHER_TYPE_MAX && supported_ditherings[type].ed;
+}
+EXPORT_SYMBOL(dither_is_diffusion);
+
+/**
+ * dither_ed_init - allocate the error rows of an error diffusion state
+ * @dev: device the rows are tied to
+ * @ed: state to initialize
+ * @width: longest line that will be dithered
+ *
+ * Returns:
+ * Zero on success, negative error code on failure.
+ */
+int dither_ed_init(struct device *dev, struct dither_ed *ed, uint width)
+{
+	uint stride = width + 2 * DITHER_ED_MARGIN;
+	s16 *rows;
+	int i;
+
+	rows = devm_kcalloc(dev, DITHER_ED_ROWS * stride, sizeof(*rows),
+			    GFP_KERNEL);
+	if (!rows)
+		return -ENOMEM;
+
+	for (i = 0; i < DITHER_ED_ROWS; i++)
+		ed->rows[i] = rows + i * stride + DITHER_ED_MARGIN;
+	ed->stride = stride;
+	ed->width = width;
+	ed->next_y = 0;
+
+	return 0;
+}
+EXPORT_SYMBOL(dither_ed_init);
+
+static void dither_ed_clear_row(struct dither_ed *ed, s16 *row)
+{
+	memset(row - DITHER_ED_MARGIN, 0, ed->stride * sizeof(*row));
+}
+
+/*
+ * Inlined once per kernel so the weights become constants. Error for the
+ * pixels to the right and for the line below is carried in registers, the
+ * row below is written once per pixel when its value is final.
+ */
+static __always_inline void dither_ed_line(s16 *const *rows,
+					   const struct dither_ed_kernel *k,
+					   u8 *dst, const u8 *src, int width)
+{
+	const s16 *cur = rows[0];
+	s16 *below = rows[1], *below2 = rows[2];
+	int r1 = 0, r2 = 0; // this line, at i and i + 1
+	int b0 = 0, b1 = 0; // line below, at i - 1 and i
+	int i, v, err;
+
+	for (i = 0; i < width; i++) {
+		v = cur[i] + r1;
+		v = src[i] + ((v + (1 << (k->shift - 1))) >> k->shift);
+		dst[i] = v > 0x7F ? 0xFF : 0x00;
+		err = v - dst[i];
+
+		r1 = r2 + k->r1 * err;
+		r2 = k->r2 * err;
+
+		below[i - 1] += b0 + k->dl * err;
+		b0 = b1 + k->d * err;
+		b1 = k->dr * err;
+
+		if (k->d2)
+			below2[i] += k->d2 * err;
+	}
+
+	below[i - 1] += b0;
+	below[i] += b1;
+}
+
+/**
+ * dither_ed_gray8_line_to_bw - error diffuse one 8-bit gray scanline
+ * @ed: error rows set up by dither_ed_init()
+ * @type: an error diffusion dither type, see dither_is_diffusion()
+ * @dst: destination, one byte (0x00 or 0xFF) per pixel, may equal @src
+ * @src: gray pixels of a whole line
+ * @y: row of the line
+ * @width: number of pixels, at most the width passed to dither_ed_init()
+ *
+ * Lines must be passed top to bottom starting at row 0, any other @y starts
+ * over with no error carried in. The accumulated error is kept in s16 in
+ * units of 1/2^shift of a gray level, so only shifts are needed.
+ */
+void dither_ed_gray8_line_to_bw(struct dither_ed *ed, u8 type, u8 *dst,
+				const u8 *src, uint y, uint width)
+{
+	s16 *tmp;
+	int i;
 
-	if (!src || !dst || !supported_ditherings[type].algo)
+	if (WARN_ON_ONCE(!dither_is_diffusion(type) || width > ed->width))
 		return;
 
-	supported_ditherings[type].algo(src, dst, width, height);
+	if (y != ed->next_y || !y)
+		for (i = 0; i < DITHER_ED_ROWS; i++)
+			dither_ed_clear_row(ed, ed->rows[i]);
+	ed->next_y = y + 1;
+
+	switch (type) {
+	case DITHER_TYPE_FLOYD_STEINBERG:
+		dither_ed_line(ed->rows, &floyd_steinberg, dst, src, width);
+		break;
+	case DITHER_TYPE_ATKINSON:
+		dither_ed_line(ed->rows, &atkinson, dst, src, width);
+		break;
+	case DITHER_TYPE_SIERRA_LITE:
+		dither_ed_line(ed->rows, &sierra_lite, dst, src, width);
+		break;
+	}
+
+	/* rotate, the consumed row becomes the empty one two lines down */
+	tmp = ed->rows[0];
+	dither_ed_clear_row(ed, tmp);
+	memmove(&ed->rows[0], &ed->rows[1],
+		(DITHER_ED_ROWS - 1) * sizeof(ed->rows[0]));
+	ed->rows[DITHER_ED_ROWS - 1] = tmp;
+}
+EXPORT_SYMBOL(dither_ed_gray8_line_to_bw);
+
+/* Gray of a XRGB8888 line, the input of the error diffusion */
+void dither_xrgb8888_line_to_gray8(u8 *dst, const u32 *src, uint width)
+{
+	uint i;
+
+	for (i = 0; i < width; i++)
+		dst[i] = xrgb8888_to_luma(src[i]);
+}
+EXPORT_SYMBOL(dither_xrgb8888_line_to_gray8);
+
+/* Threshold matrix row of line @y, columns wrap with *@mask */
+static const u8 *dither_row(u8 type, uint y, uint *mask)
+{
+	const struct dither *d;
+
+	if (unlikely(type >= DITHER_TYPE_MAX))
+		type = DITHER_TYPE_NONE;
+
+	d = &supported_ditherings[type];
+	*mask = d->order - 1;
+
+	return d->matrix + (y & *mask) * d->order;
+}
+
+static void dither_line_scalar(const u8 *row, uint mask, u8 *dst,
+			       const u32 *src, uint x, uint width)
+{
+	uint i;
+
+	for (i = 0; i < width; i++) {
+		u8 gray = xrgb8888_to_luma(src[i]);
+
+		dst[i] = (gray > row[(x + i) & mask]) ? 0xFF : 0x00;
+	}
+}
+
+static void dither_gray8_line_scalar(const u8 *row, uint mask, u8 *dst,
+				     const u8 *src, uint x, uint width)
+{
+	uint i;
+
+	for (i = 0; i < width; i++)
+		dst[i] = (src[i] > row[(x + i) & mask]) ? 0xFF : 0x00;
+}
+
+/**
+ * dither_xrgb8888_line_to_bw - convert one scanline straight to black/white
+ * @type: dither type
+ * @dst: destination, one byte (0x00 or 0xFF) per pixel
+ * @src: XRGB8888 pixels
+ * @x: absolute column of the first pixel
+ * @y: absolute row of the line
+ * @width: number of pixels
+ *
+ * Computes luma and thresholds it in a single pass, the threshold matrix is
+ * indexed by absolute coordinates so any sub-rectangle gives the same result
+ * as a full frame conversion.
+ */
+void dither_xrgb8888_line_to_bw(u8 type, u8 *dst, const u32 *src, uint x,
+				uint y, uint width)
+{
+	uint mask;
+	const u8 *row = dither_row(type, y, &mask);
+
+	dither_line_scalar(row, mask, dst, src, x, width);
+}
+EXPORT_SYMBOL(dither_xrgb8888_line_to_bw);
+
+/**
+ * dither_gray8_line_to_bw - threshold one 8-bit gray scanline
+ *
+ * Same as dither_xrgb8888_line_to_bw() for R8 pixels.
+ */
+void dither_gray8_line_to_bw(u8 type, u8 *dst, const u8 *src, uint x, uint y,
+			     uint width)
+{
+	uint mask;
+	const u8 *row = dither_row(type, y, &mask);
+
+	dither_gray8_line_scalar(row, mask, dst, src, x, width);
+}
+EXPORT_SYMBOL(dither_gray8_line_to_bw);
+
+/**
+ * dither_r1_line_to_bw - expand one R1 scanline to black/white bytes
+ * @dst: destination, one byte (0x00 or 0xFF) per pixel
+ * @src: start of the R1 line
+ * @x: first column to expand
+ * @width: number of pixels
+ *
+ * R1 already is black/white, see DITHER_R1_BIT() for the bit order.
+ */
+void dither_r1_line_to_bw(u8 *dst, const u8 *src, uint x, uint width)
+{
+	uint i;
+
+	for (i = 0; i < width; i++, x++)
+		dst[i] = (src[x >> 3] & DITHER_R1_BIT(x)) ? 0xFF : 0x00;
+}
+EXPORT_SYMBOL(dither_r1_line_to_bw);
+
+#ifdef CONFIG_KERNEL_MODE_NEON
+/**
+ * dither_xrgb8888_line_to_bw_neon - NEON variant of
+ * dither_xrgb8888_line_to_bw()
+ *
+ * Same arguments and output as the scalar version. The vector loop starts
+ * on a 16 pixel aligned column so each threshold matrix row can be loaded
+ * as is. Must be called between kernel_neon_begin() and kernel_neon_end().
+ */
+void dither_xrgb8888_line_to_bw_neon(u8 type, u8 *dst, const u32 *src, uint x,
+				     uint y, uint width)
+{
+	uint mask, head, n;
+	const u8 *row = dither_row(type, y, &mask);
+
+	head = min(width, -x & 15);
+	dither_line_scalar(row, mask, dst, src, x, head);
+
+	n = round_down(width - head, 16);
+	dither_neon_xrgb8888_to_bw(dst + head, src + head, row, mask + 1,
+				   x + head, n);
+
+	head += n;
+	dither_line_scalar(row, mask, dst + head, src + head, x + head,
+			   width - head);
+}
+EXPORT_SYMBOL(dither_xrgb8888_line_to_bw_neon);
+
+/**
+ * dither_gray8_line_to_bw_neon - NEON variant of dither_gray8_line_to_bw()
+ *
+ * See dither_xrgb8888_line_to_bw_neon().
+ */
+void dither_gray8_line_to_bw_neon(u8 type, u8 *dst, const u8 *src, uint x,
+				  uint y, uint width)
+{
+	uint mask, head, n;
+	const u8 *row = dither_row(type, y, &mask);
+
+	head = min(width, -x & 15);
+	dither_gray8_line_scalar(row, mask, dst, src, x, head);
+
+	n = round_down(width - head, 16);
+	dither_neon_gray8_to_bw(dst + head, src + head, row, mask + 1,
+				x + head, n);
+
+	head += n;
+	dither_gray8_line_scalar(row, mask, dst + head, src + head, x + head,
+				 width - head);
 }
-EXPORT_SYMBOL(dither_gray8_to_bw);
+EXPORT_SYMBOL(dither_gray8_line_to_bw_neon);
+#endif
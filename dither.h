@@ -7,10 +7,46 @@ enum {
 	DITHER_TYPE_NONE,
 	DITHER_TYPE_BAYER_4X4,
 	DITHER_TYPE_BAYER_16X16,
+	DITHER_TYPE_FLOYD_STEINBERG,
+	DITHER_TYPE_ATKINSON,
+	DITHER_TYPE_SIERRA_LITE,
+	DITHER_TYPE_BLUE_NOISE,
 	DITHER_TYPE_MAX,
 };
 
+/* R1 has the leftmost pixel in the MSB, a set bit is white */
+#define DITHER_R1_BIT(x) (0x80 >> ((x) & 7))
+
+/* Kernels reach up to 2 columns to either side and 2 lines down */
+#define DITHER_ED_MARGIN 2
+#define DITHER_ED_ROWS 3
+
+/* Error rows of the line being dithered and the two below it */
+struct dither_ed {
+	s16 *rows[DITHER_ED_ROWS];
+	uint stride;
+	uint width;
+	uint next_y;
+};
+
+struct device;
+
 const char *dither_get_name(u8 type);
-void dither_gray8_to_bw(u8 type, const u8 *src, u8 *dst, int width, int height);
+bool dither_is_diffusion(u8 type);
+int dither_ed_init(struct device *dev, struct dither_ed *ed, uint width);
+void dither_ed_gray8_line_to_bw(struct dither_ed *ed, u8 type, u8 *dst,
+				const u8 *src, uint y, uint width);
+void dither_xrgb8888_line_to_gray8(u8 *dst, const u32 *src, uint width);
+void dither_xrgb8888_line_to_bw(u8 type, u8 *dst, const u32 *src, uint x,
+				uint y, uint width);
+void dither_gray8_line_to_bw(u8 type, u8 *dst, const u8 *src, uint x, uint y,
+			     uint width);
+void dither_r1_line_to_bw(u8 *dst, const u8 *src, uint x, uint width);
+#ifdef CONFIG_KERNEL_MODE_NEON
+void dither_xrgb8888_line_to_bw_neon(u8 type, u8 *dst, const u32 *src, uint x,
+				     uint y, uint width);
+void dither_gray8_line_to_bw_neon(u8 type, u8 *dst, const u8 *src, uint x,
+				  uint y, uint width);
+#endif
 
 #endif /* __DETHER_H */
@@ -20,12 +20,16 @@
 #include <drm/drm_format_helper.h>
 #include <drm/drm_fourcc.h>
 #include <drm/drm_gem_framebuffer_helper.h>
-#include <drm/drm_mipi_dbi.h>
 #include <drm/drm_modes.h>
 #include <drm/drm_probe_helper.h>
 #include <drm/drm_rect.h>
 #include <video/mipi_display.h>
 
+#include "drm_mipi_dbi.h"
+
+#define CREATE_TRACE_POINTS
+#include "drm_mipi_dbi_trace.h"
+
 #define MIPI_DBI_MAX_SPI_READ_SPEED 2000000 /* 2MHz */
 
 #define DCS_POWER_MODE_DISPLAY			BIT(2)
@@ -138,6 +142,75 @@ int mipi_dbi_command_read(struct mipi_dbi *dbi, u8 cmd, u8 *val)
 }
 EXPORT_SYMBOL(mipi_dbi_command_read);
 
+/* Far longer than a full frame takes even at the slowest usable clock */
+#define MIPI_DBI_ASYNC_TIMEOUT_MS 1000
+
+/*
+ * The D/C line must not change while a write is still on the bus. A write
+ * that times out stays pending, the controller still owns the message.
+ */
+static int mipi_dbi_async_wait_locked(struct mipi_dbi *dbi)
+{
+	struct mipi_dbi_async *async = dbi->async;
+
+	if (!async)
+		return 0;
+
+	if (!wait_for_completion_timeout(&async->done,
+			msecs_to_jiffies(MIPI_DBI_ASYNC_TIMEOUT_MS))) {
+		async->status = -ETIMEDOUT;
+		return -ETIMEDOUT;
+	}
+	dbi->async = NULL;
+
+	return async->status;
+}
+
+/**
+ * mipi_dbi_async_wait - Wait for an asynchronous write to complete
+ * @dbi: MIPI DBI structure
+ *
+ * Waits for the write started by mipi_dbi_command_buf_async(), if it is still
+ * in flight. After this returns the data buffer can be reused, unless the
+ * wait timed out: the write then stays in flight and the next wait retries.
+ *
+ * Returns:
+ * Status of the write that was waited for, zero if there was none,
+ * -ETIMEDOUT if it did not complete in time.
+ */
+int mipi_dbi_async_wait(struct mipi_dbi *dbi)
+{
+	int ret;
+
+	mutex_lock(&dbi->cmdlock);
+	ret = mipi_dbi_async_wait_locked(dbi);
+	mutex_unlock(&dbi->cmdlock);
+
+	return ret;
+}
+EXPORT_SYMBOL(mipi_dbi_async_wait);
+
+/* SPI requires dma-safe buffers, the command byte goes out of cmd_buf */
+static int mipi_dbi_command_locked(struct mipi_dbi *dbi, u8 cmd, u8 *data,
+				   size_t len)
+{
+	int ret;
+
+	lockdep_assert_held(&dbi->cmdlock);
+
+	/* a failed write is reported to its owner, a stuck one blocks the bus */
+	ret = mipi_dbi_async_wait_locked(dbi);
+	if (ret == -ETIMEDOUT)
+		return ret;
+	dbi->cmd_buf[0] = cmd;
+
+	trace_mipi_dbi_cmd_begin(cmd, len);
+	ret = dbi->command(dbi, dbi->cmd_buf, data, len);
+	trace_mipi_dbi_cmd_end(cmd, len, ret);
+
+	return ret;
+}
+
 /**
  * mipi_dbi_command_buf - MIPI DCS command with parameter(s) in an array
  * @dbi: MIPI DBI structure
@@ -150,20 +223,12 @@ EXPORT_SYMBOL(mipi_dbi_command_read);
  */
 int mipi_dbi_command_buf(struct mipi_dbi *dbi, u8 cmd, u8 *data, size_t len)
 {
-	u8 *cmdbuf;
 	int ret;
 
-	/* SPI requires dma-safe buffers */
-	cmdbuf = kmemdup(&cmd, 1, GFP_KERNEL);
-	if (!cmdbuf)
-		return -ENOMEM;
-
 	mutex_lock(&dbi->cmdlock);
-	ret = dbi->command(dbi, cmdbuf, data, len);
+	ret = mipi_dbi_command_locked(dbi, cmd, data, len);
 	mutex_unlock(&dbi->cmdlock);
 
-	kfree(cmdbuf);
-
 	return ret;
 }
 EXPORT_SYMBOL(mipi_dbi_command_buf);
@@ -175,6 +240,16 @@ int mipi_dbi_command_stackbuf(struct mipi_dbi *dbi, u8 cmd, const u8 *data,
 	u8 *buf;
 	int ret;
 
+	if (len <= MIPI_DBI_CMD_PARAM_SIZE) {
+		mutex_lock(&dbi->cmdlock);
+		buf = dbi->cmd_buf + MIPI_DBI_CMD_PARAM_OFFSET;
+		memcpy(buf, data, len);
+		ret = mipi_dbi_command_locked(dbi, cmd, buf, len);
+		mutex_unlock(&dbi->cmdlock);
+
+		return ret;
+	}
+
 	buf = kmemdup(data, len, GFP_KERNEL);
 	if (!buf)
 		return -ENOMEM;
@@ -187,6 +262,57 @@ int mipi_dbi_command_stackbuf(struct mipi_dbi *dbi, u8 cmd, const u8 *data,
 }
 EXPORT_SYMBOL(mipi_dbi_command_stackbuf);
 
+/**
+ * mipi_dbi_command_table - Send a table of MIPI DCS commands
+ * @dbi: MIPI DBI structure
+ * @table: Entries built with MIPI_DBI_CMD() and MIPI_DBI_DELAY(), terminated
+ *         by MIPI_DBI_END
+ *
+ * The whole table is sent with &mipi_dbi->cmdlock held and the parameters
+ * are staged in the preallocated command buffer, so nothing is allocated and
+ * no other command can slip in between.
+ *
+ * Returns:
+ * Zero on success, negative error code on failure.
+ */
+int mipi_dbi_command_table(struct mipi_dbi *dbi, const u8 *table)
+{
+	u8 *par = dbi->cmd_buf + MIPI_DBI_CMD_PARAM_OFFSET;
+	const u8 *p = table;
+	int ret = 0;
+	u8 cmd, len;
+
+	mutex_lock(&dbi->cmdlock);
+
+	for (;;) {
+		cmd = *p++;
+		len = *p++;
+
+		if (cmd == MIPI_DCS_NOP) {
+			if (!len)
+				break;
+			msleep(*p);
+		} else {
+			if (WARN_ON(len > MIPI_DBI_CMD_PARAM_SIZE)) {
+				ret = -EINVAL;
+				break;
+			}
+
+			memcpy(par, p, len);
+			ret = mipi_dbi_command_locked(dbi, cmd, par, len);
+			if (ret)
+				break;
+		}
+
+		p += len;
+	}
+
+	mutex_unlock(&dbi->cmdlock);
+
+	return ret;
+}
+EXPORT_SYMBOL(mipi_dbi_command_table);
+
 /**
  * mipi_dbi_buf_copy - Copy a framebuffer, transforming it if necessary
  * @dst: The destination buffer
@@ -1090,6 +1216,12 @@ int mipi_dbi_spi_init(struct spi_device *spi, struct mipi_dbi *dbi,
 	dbi->spi = spi;
 	dbi->read_commands = mipi_dbi_dcs_read_commands;
 
+	/* kmalloc memory is cacheline aligned, so both halves are dma-safe */
+	dbi->cmd_buf = devm_kmalloc(dev, MIPI_DBI_CMD_PARAM_OFFSET +
+				    MIPI_DBI_CMD_PARAM_SIZE, GFP_KERNEL);
+	if (!dbi->cmd_buf)
+		return -ENOMEM;
+
 	if (dc) {
 		dbi->command = mipi_dbi_typec3_command;
 		dbi->dc = dc;
@@ -1111,6 +1243,51 @@ int mipi_dbi_spi_init(struct spi_device *spi, struct mipi_dbi *dbi,
 }
 EXPORT_SYMBOL(mipi_dbi_spi_init);
 
+/*
+ * Chain as much of @buf as fits into one message: chunks the SPI controller
+ * driver can handle, at most MIPI_DBI_SPI_MAX_XFERS of them and no more than
+ * spi_max_message_size() in total. Returns the number of bytes queued.
+ */
+static size_t mipi_dbi_spi_prepare(struct spi_device *spi,
+				   struct spi_message *m,
+				   struct spi_transfer *tr, u32 speed_hz,
+				   u8 bpw, const void *buf, size_t len)
+{
+	size_t max_chunk = spi_max_transfer_size(spi);
+	size_t max_msg = spi_max_message_size(spi);
+	size_t chunk, queued = 0;
+	unsigned int i;
+
+	/* In __spi_validate, there's a validation that no partial transfers
+	 * are accepted (xfer->len % w_size must be zero).
+	 * Here we align max_chunk to multiple of 2 (16bits),
+	 * to prevent transfers from being rejected.
+	 */
+	max_chunk = ALIGN_DOWN(max_chunk, 2);
+	max_msg = ALIGN_DOWN(max_msg, 2);
+
+	spi_message_init(m);
+
+	for (i = 0; i < MIPI_DBI_SPI_MAX_XFERS && len; i++) {
+		chunk = min3(len, max_chunk, max_msg - queued);
+		if (!chunk)
+			break;
+
+		memset(&tr[i], 0, sizeof(tr[i]));
+		tr[i].tx_buf = buf;
+		tr[i].len = chunk;
+		tr[i].bits_per_word = bpw;
+		tr[i].speed_hz = speed_hz;
+		spi_message_add_tail(&tr[i], m);
+
+		buf += chunk;
+		len -= chunk;
+		queued += chunk;
+	}
+
+	return queued;
+}
+
 /**
  * mipi_dbi_spi_transfer - SPI transfer helper
  * @spi: SPI device
@@ -1120,7 +1297,8 @@ EXPORT_SYMBOL(mipi_dbi_spi_init);
  * @len: Buffer length
  *
  * This SPI transfer helper breaks up the transfer of @buf into chunks which
- * the SPI controller driver can handle.
+ * the SPI controller driver can handle. The chunks are chained into as few
+ * messages as possible so the controller streams them back to back.
  *
  * Returns:
  * Zero on success, negative error code on failure.
@@ -1128,29 +1306,14 @@ EXPORT_SYMBOL(mipi_dbi_spi_init);
 int mipi_dbi_spi_transfer(struct spi_device *spi, u32 speed_hz,
 			  u8 bpw, const void *buf, size_t len)
 {
-	size_t max_chunk = spi_max_transfer_size(spi);
-	struct spi_transfer tr = {
-		.bits_per_word = bpw,
-		.speed_hz = speed_hz,
-	};
+	struct spi_transfer tr[MIPI_DBI_SPI_MAX_XFERS];
 	struct spi_message m;
 	size_t chunk;
 	int ret;
 
-	/* In __spi_validate, there's a validation that no partial transfers
-	 * are accepted (xfer->len % w_size must be zero).
-	 * Here we align max_chunk to multiple of 2 (16bits),
-	 * to prevent transfers from being rejected.
-	 */
-	max_chunk = ALIGN_DOWN(max_chunk, 2);
-
-	spi_message_init_with_transfers(&m, &tr, 1);
-
 	while (len) {
-		chunk = min(len, max_chunk);
-
-		tr.tx_buf = buf;
-		tr.len = chunk;
+		chunk = mipi_dbi_spi_prepare(spi, &m, tr, speed_hz, bpw, buf,
+					     len);
 		buf += chunk;
 		len -= chunk;
 
@@ -1163,6 +1326,103 @@ int mipi_dbi_spi_transfer(struct spi_device *spi, u32 speed_hz,
 }
 EXPORT_SYMBOL(mipi_dbi_spi_transfer);
 
+static void mipi_dbi_async_complete(void *context)
+{
+	struct mipi_dbi_async *async = context;
+
+	async->status = async->m.status;
+	trace_mipi_dbi_cmd_end(async->cmd, async->len, async->status);
+	if (async->complete)
+		async->complete(async);
+	complete(&async->done);
+}
+
+/**
+ * mipi_dbi_command_buf_async - MIPI DCS command with asynchronous data write
+ * @dbi: MIPI DBI structure
+ * @cmd: Command
+ * @data: Parameter buffer, must stay untouched until the write has completed
+ * @len: Buffer length
+ * @async: Transfer storage owned by the caller
+ *
+ * Sends @cmd and queues @data with spi_async(), the function returns while the
+ * SPI controller is still streaming. &mipi_dbi_async->complete is called when
+ * the last byte went out. The next command on @dbi waits for the write to
+ * finish before touching the D/C line, use mipi_dbi_async_wait() to wait for
+ * it explicitly before reusing @data or @async.
+ *
+ * Interfaces without a D/C gpio fall back to mipi_dbi_command_buf().
+ *
+ * Returns:
+ * Zero on success, negative error code on failure. The completion callback is
+ * only called on success.
+ */
+int mipi_dbi_command_buf_async(struct mipi_dbi *dbi, u8 cmd, u8 *data,
+			       size_t len, struct mipi_dbi_async *async)
+{
+	struct spi_device *spi = dbi->spi;
+	unsigned int bpw = 8;
+	u32 speed_hz;
+	size_t chunk;
+	int ret;
+
+	async->len = len;
+
+	if (!dbi->dc || !len) {
+		ret = mipi_dbi_command_buf(dbi, cmd, data, len);
+		async->status = ret;
+		if (!ret && async->complete)
+			async->complete(async);
+		return ret;
+	}
+
+	mutex_lock(&dbi->cmdlock);
+
+	ret = mipi_dbi_command_locked(dbi, cmd, NULL, 0);
+	if (ret)
+		goto out_unlock;
+
+	if (cmd == MIPI_DCS_WRITE_MEMORY_START && !dbi->swap_bytes)
+		bpw = 16;
+
+	gpiod_set_value_cansleep(dbi->dc, 1);
+	speed_hz = mipi_dbi_spi_cmd_max_speed(spi, len);
+
+	/* Only the tail goes out asynchronously if it takes several messages */
+	for (;;) {
+		chunk = mipi_dbi_spi_prepare(spi, &async->m, async->tr,
+					     speed_hz, bpw, data, len);
+		data += chunk;
+		len -= chunk;
+		if (!len)
+			break;
+
+		ret = spi_sync(spi, &async->m);
+		if (ret)
+			goto out_unlock;
+	}
+
+	init_completion(&async->done);
+	async->cmd = cmd;
+	async->m.complete = mipi_dbi_async_complete;
+	async->m.context = async;
+
+	trace_mipi_dbi_cmd_begin(cmd, async->len);
+
+	ret = spi_async(spi, &async->m);
+	if (!ret)
+		dbi->async = async;
+
+out_unlock:
+	mutex_unlock(&dbi->cmdlock);
+
+	if (ret)
+		async->status = ret;
+
+	return ret;
+}
+EXPORT_SYMBOL(mipi_dbi_command_buf_async);
+
 #endif /* CONFIG_SPI */
 
 #ifdef CONFIG_DEBUG_FS
@@ -0,0 +1,56 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM mipi_dbi
+
+#if !defined(__DRM_MIPI_DBI_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define __DRM_MIPI_DBI_TRACE_H
+
+#include <linux/tracepoint.h>
+
+/* DCS commands of the MIPI DBI core, drm_mipi_dbi.c creates them */
+
+TRACE_EVENT(mipi_dbi_cmd_begin,
+	TP_PROTO(u8 cmd, size_t len),
+	TP_ARGS(cmd, len),
+
+	TP_STRUCT__entry(
+		__field(u8, cmd)
+		__field(size_t, len)
+	),
+
+	TP_fast_assign(
+		__entry->cmd = cmd;
+		__entry->len = len;
+	),
+
+	TP_printk("cmd=0x%02x len=%zu", __entry->cmd, __entry->len)
+);
+
+/* Asynchronous writes end from the SPI completion */
+TRACE_EVENT(mipi_dbi_cmd_end,
+	TP_PROTO(u8 cmd, size_t len, int ret),
+	TP_ARGS(cmd, len, ret),
+
+	TP_STRUCT__entry(
+		__field(u8, cmd)
+		__field(size_t, len)
+		__field(int, ret)
+	),
+
+	TP_fast_assign(
+		__entry->cmd = cmd;
+		__entry->len = len;
+		__entry->ret = ret;
+	),
+
+	TP_printk("cmd=0x%02x len=%zu ret=%d", __entry->cmd, __entry->len,
+		  __entry->ret)
+);
+
+#endif /* __DRM_MIPI_DBI_TRACE_H */
+
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE drm_mipi_dbi_trace
+#include <trace/define_trace.h>
@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Framebuffer to display RAM conversion of the st7305 driver
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <linux/device.h>
+#include <linux/kernel.h>
+#include <linux/ktime.h>
+#include <linux/string.h>
+
+#ifdef CONFIG_KERNEL_MODE_NEON
+#include <asm/neon.h>
+#endif
+
+#include <drm/drm_fourcc.h>
+#include <drm/drm_rect.h>
+
+#include "st7305-convert.h"
+#include "st7305-pack.h"
+#include "st7305-panel.h"
+
+#ifndef CONFIG_KERNEL_MODE_NEON
+/* never called, the callers only ask for NEON with kernel mode NEON */
+static inline void kernel_neon_begin(void) {}
+static inline void kernel_neon_end(void) {}
+#endif
+
+int st7305_convert_init(struct device *dev, struct st7305_convert *conv,
+			const struct st7305_panel *panel)
+{
+	conv->panel = panel;
+
+	conv->line_buf = devm_kmalloc(dev, 2 * panel->width, GFP_KERNEL);
+	if (!conv->line_buf)
+		return -ENOMEM;
+
+	conv->src_buf = devm_kzalloc(dev, panel->width * sizeof(u32),
+				     GFP_KERNEL);
+	if (!conv->src_buf)
+		return -ENOMEM;
+
+	return dither_ed_init(dev, &conv->ed, panel->width);
+}
+
+/*
+ * Error diffusion goes through gray first and has to see whole lines in
+ * order, st7305_pipe_update() hands it the full frame.
+ */
+static void st7305_line_to_bw_ed(struct dither_ed *ed, u8 type, u32 format,
+				 u8 *dst, const void *src, uint y, uint width)
+{
+	if (format == DRM_FORMAT_R8) {
+		dither_ed_gray8_line_to_bw(ed, type, dst, src, y, width);
+	} else {
+		dither_xrgb8888_line_to_gray8(dst, src, width);
+		dither_ed_gray8_line_to_bw(ed, type, dst, dst, y, width);
+	}
+}
+
+/* @src is the start of framebuffer line @y, @x the first column to convert */
+void st7305_line_to_bw(struct st7305_convert *conv, bool neon, u8 type,
+		       u32 format, u8 *dst, const void *src, uint x, uint y,
+		       uint width)
+{
+#ifdef DRM_FORMAT_R1
+	if (format == DRM_FORMAT_R1) {
+		dither_r1_line_to_bw(dst, src, x, width);
+		return;
+	}
+#endif
+
+	if (dither_is_diffusion(type) && !x) {
+		st7305_line_to_bw_ed(&conv->ed, type, format, dst, src, y,
+				     width);
+		return;
+	}
+
+	switch (format) {
+	case DRM_FORMAT_R8:
+#ifdef CONFIG_KERNEL_MODE_NEON
+		if (neon) {
+			dither_gray8_line_to_bw_neon(type, dst, (const u8 *)src + x,
+						     x, y, width);
+			return;
+		}
+#endif
+		dither_gray8_line_to_bw(type, dst, (const u8 *)src + x, x, y,
+					width);
+		return;
+	}
+
+#ifdef CONFIG_KERNEL_MODE_NEON
+	if (neon) {
+		dither_xrgb8888_line_to_bw_neon(type, dst, (const u32 *)src + x,
+						x, y, width);
+		return;
+	}
+#endif
+	dither_xrgb8888_line_to_bw(type, dst, (const u32 *)src + x, x, y,
+				   width);
+}
+
+static uint st7305_cpp(u32 format)
+{
+	return format == DRM_FORMAT_R8 ? 1 : 4;
+}
+
+/*
+ * Source pixels of panel row @y, indexed by panel column. Without rotation
+ * this is the framebuffer line itself, otherwise columns [@x1, @x2) are
+ * gathered into src_buf, still in the framebuffer format. The rotation is
+ * counter clockwise like &mipi_dbi_dev->rotation.
+ *
+ * With @src->bounce the unrotated line lives in write-combined memory, where
+ * every load the converters issue goes out to the bus on its own. The
+ * damaged span is then copied into src_buf with memcpy(), whose multi
+ * register loads turn into bursts, and converted from the cache.
+ */
+static const void *st7305_src_line(struct st7305_convert *conv,
+				   const struct st7305_src *src, uint x1,
+				   uint x2, uint y)
+{
+	int w = conv->panel->width;
+	int h = conv->panel->height;
+	int pitch = src->pitch;
+	int cpp = st7305_cpp(src->format);
+	int fx, fy, dx, dy, step;
+	const u8 *line;
+	uint x;
+
+	/* framebuffer pixel of panel pixel (x, y) is (fx + x dx, fy + x dy) */
+	switch (src->rotation) {
+	case 90:
+		fx = h - 1 - y;
+		fy = 0;
+		dx = 0;
+		dy = 1;
+		break;
+	case 180:
+		fx = w - 1;
+		fy = h - 1 - y;
+		dx = -1;
+		dy = 0;
+		break;
+	case 270:
+		fx = y;
+		fy = w - 1;
+		dx = 0;
+		dy = -1;
+		break;
+	default:
+		line = src->vaddr + y * pitch;
+		if (!src->bounce)
+			return line;
+
+		step = cpp;
+#ifdef DRM_FORMAT_R1
+		if (src->format == DRM_FORMAT_R1) {
+			x1 >>= 3;
+			x2 = DIV_ROUND_UP(x2, 8);
+			step = 1;
+		}
+#endif
+		memcpy(conv->src_buf + x1 * step, line + x1 * step,
+		       (x2 - x1) * step);
+
+		return conv->src_buf;
+	}
+
+	fx += x1 * dx;
+	fy += x1 * dy;
+
+#ifdef DRM_FORMAT_R1
+	if (src->format == DRM_FORMAT_R1) {
+		u8 *dst = conv->src_buf;
+
+		for (x = x1; x < x2; x++, fx += dx, fy += dy) {
+			line = src->vaddr + fy * pitch;
+			if (line[fx >> 3] & DITHER_R1_BIT(fx))
+				dst[x >> 3] |= DITHER_R1_BIT(x);
+			else
+				dst[x >> 3] &= ~DITHER_R1_BIT(x);
+		}
+
+		return dst;
+	}
+#endif
+
+	line = src->vaddr + fy * pitch + fx * cpp;
+	step = dy * pitch + dx * cpp;
+
+	if (src->format == DRM_FORMAT_R8) {
+		u8 *dst = conv->src_buf;
+
+		for (x = x1; x < x2; x++, line += step)
+			dst[x] = *line;
+	} else {
+		u32 *dst = conv->src_buf;
+
+		for (x = x1; x < x2; x++, line += step)
+			dst[x] = *(const u32 *)line;
+	}
+
+	return conv->src_buf;
+}
+
+/*
+ * Single pass conversion: every page is built from two scanlines which are
+ * converted to black/white straight from the framebuffer into a small line
+ * buffer, then packed into @dst. No full frame intermediates are needed.
+ * @clip is in panel coordinates, aligned by st7305_align_clip().
+ *
+ * XRGB8888 and R8 go through luma and the dither threshold or the error
+ * diffusion, R1 already is black/white and only gets expanded to bytes for
+ * the packer. The time spent in either stage is added to @convert_ns and
+ * @pack_ns.
+ */
+void st7305_fb_to_mono(struct st7305_convert *conv, u8 *dst,
+		       const struct st7305_src *src,
+		       const struct drm_rect *clip, u8 type, bool neon,
+		       u64 *convert_ns, u64 *pack_ns)
+{
+	const struct st7305_panel *panel = conv->panel;
+	const struct st7305_packer *packer = panel->packer;
+	uint width = clip->x2 - clip->x1;
+	u8 *row0 = conv->line_buf;
+	u8 *row1 = conv->line_buf + width;
+	u32 format = src->format;
+	ktime_t t0, t1, t2;
+	const void *line;
+	unsigned int y;
+	u8 *dst_page;
+
+	for (y = clip->y1; y < clip->y2; y += 2) {
+		if (neon)
+			kernel_neon_begin();
+
+		t0 = ktime_get();
+		line = st7305_src_line(conv, src, clip->x1, clip->x2, y);
+		st7305_line_to_bw(conv, neon, type, format, row0, line,
+				  clip->x1, y, width);
+
+		/* odd trailing row, the second row of the page is off panel */
+		if (y + 1 < clip->y2) {
+			line = st7305_src_line(conv, src, clip->x1, clip->x2,
+					       y + 1);
+			st7305_line_to_bw(conv, neon, type, format, row1, line,
+					  clip->x1, y + 1, width);
+		} else {
+			memcpy(row1, row0, width);
+		}
+		t1 = ktime_get();
+
+		dst_page = dst + (y >> 1) * panel->page_size;
+		if (neon) {
+			packer->pack_page_neon(dst_page, row0, row1, clip->x1,
+					       clip->x2, panel->left_offset);
+			kernel_neon_end();
+		} else {
+			packer->pack_page(dst_page, row0, row1, clip->x1,
+					  clip->x2, panel->left_offset);
+		}
+		t2 = ktime_get();
+
+		*convert_ns += ktime_to_ns(ktime_sub(t1, t0));
+		*pack_ns += ktime_to_ns(ktime_sub(t2, t1));
+	}
+}
+
+/*
+ * A diagonal ramp and seeded noise. The noise comes from a plain LCG, so
+ * that the in-kernel and the host bench see the same frames.
+ */
+void st7305_bench_fill(u8 *gray, uint width, uint height, int pattern)
+{
+	u32 seed = 0x7305;
+	uint x, y;
+
+	if (pattern) {
+		for (x = 0; x < width * height; x++) {
+			seed = seed * 1103515245 + 12345;
+			gray[x] = seed >> 16;
+		}
+		return;
+	}
+
+	for (y = 0; y < height; y++)
+		for (x = 0; x < width; x++)
+			gray[y * width + x] = (x * 255 / width +
+					       y * 255 / height) / 2;
+}
+
+/* Lay the gray frame out in @format, returns the pitch */
+uint st7305_bench_format(void *dst, const u8 *gray, uint width, uint height,
+			 u32 format)
+{
+	uint i;
+
+	switch (format) {
+	case DRM_FORMAT_R8:
+		memcpy(dst, gray, width * height);
+		return width;
+#ifdef DRM_FORMAT_R1
+	case DRM_FORMAT_R1: {
+		uint x, y, pitch = DIV_ROUND_UP(width, 8);
+		u8 *bits = dst;
+
+		memset(bits, 0, pitch * height);
+		for (y = 0; y < height; y++)
+			for (x = 0; x < width; x++)
+				if (gray[y * width + x] > 0x7F)
+					bits[y * pitch + x / 8] |= DITHER_R1_BIT(x);
+		return pitch;
+	}
+#endif
+	default:
+		for (i = 0; i < width * height; i++)
+			((u32 *)dst)[i] = gray[i] * 0x010101;
+		return width * 4;
+	}
+}
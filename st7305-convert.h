@@ -0,0 +1,50 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __ST7305_CONVERT_H
+#define __ST7305_CONVERT_H
+
+#include <linux/types.h>
+
+#include "dither.h"
+
+struct device;
+struct drm_rect;
+struct st7305_panel;
+
+/* A framebuffer as the conversion reads it */
+struct st7305_src {
+	void *vaddr;
+	u32 format; // DRM_FORMAT_XRGB8888, DRM_FORMAT_R8 or DRM_FORMAT_R1
+	uint pitch;
+	uint rotation; // counter clockwise like &mipi_dbi_dev->rotation
+	bool bounce; // write-combined, see st7305_src_line()
+};
+
+/* Scratch space of the conversion, one user at a time */
+struct st7305_convert {
+	const struct st7305_panel *panel;
+	/* two black/white scanlines, one page worth of pixels */
+	u8 *line_buf;
+	/*
+	 * one panel row of source pixels, gathered from a rotated framebuffer
+	 * or copied out of write-combined memory
+	 */
+	void *src_buf;
+	struct dither_ed ed; // error rows
+};
+
+int st7305_convert_init(struct device *dev, struct st7305_convert *conv,
+			const struct st7305_panel *panel);
+void st7305_line_to_bw(struct st7305_convert *conv, bool neon, u8 type,
+		       u32 format, u8 *dst, const void *src, uint x, uint y,
+		       uint width);
+void st7305_fb_to_mono(struct st7305_convert *conv, u8 *dst,
+		       const struct st7305_src *src,
+		       const struct drm_rect *clip, u8 type, bool neon,
+		       u64 *convert_ns, u64 *pack_ns);
+
+/* Synthetic frames for the benches, in the kernel and on the host */
+void st7305_bench_fill(u8 *gray, uint width, uint height, int pattern);
+uint st7305_bench_format(void *dst, const u8 *gray, uint width, uint height,
+			 u32 format);
+
+#endif /* __ST7305_CONVERT_H */
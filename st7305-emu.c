@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Virtual ST7305/ST7306 panel, decodes the DCS command stream
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <linux/device.h>
+#include <linux/kernel.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/string.h>
+#include <video/mipi_display.h>
+
+#include "st7305-emu.h"
+#include "st7305-pack.h"
+#include "st7305-panel.h"
+
+#define ST7305_EMU_HPM 0x38
+#define ST7305_EMU_LPM 0x39
+
+int st7305_emu_init(struct device *dev, struct st7305_emu *emu,
+		    const struct st7305_panel *panel)
+{
+	emu->ram = devm_kzalloc(dev, ST7305_EMU_PAGES * ST7305_EMU_PAGE_BYTES,
+				GFP_KERNEL);
+	if (!emu->ram)
+		return -ENOMEM;
+
+	mutex_init(&emu->lock);
+	emu->panel = panel;
+	emu->xe = ST7305_EMU_COLS - 1;
+	emu->ye = ST7305_EMU_PAGES - 1;
+	emu->sleeping = true;
+
+	return 0;
+}
+
+static void st7305_emu_write_start(struct st7305_emu *emu)
+{
+	emu->col = emu->xs;
+	emu->page = emu->ys;
+	emu->byte = 0;
+}
+
+/* The write pointer walks the window column by column, then page by page */
+static void st7305_emu_write(struct st7305_emu *emu, const u8 *data,
+			     size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		emu->ram[emu->page * ST7305_EMU_PAGE_BYTES + emu->col * 3 +
+			 emu->byte] = data[i];
+
+		if (++emu->byte < 3)
+			continue;
+
+		emu->byte = 0;
+		if (emu->col++ < emu->xe)
+			continue;
+
+		emu->col = emu->xs;
+		if (emu->page++ >= emu->ye)
+			emu->page = emu->ys;
+	}
+}
+
+static void st7305_emu_window(u8 *s, u8 *e, const u8 *data, size_t len,
+			      uint limit)
+{
+	if (len < 2)
+		return;
+
+	*s = min_t(uint, data[0], limit - 1);
+	*e = clamp_t(uint, data[1], *s, limit - 1);
+}
+
+void st7305_emu_command(struct st7305_emu *emu, u8 cmd, const u8 *data,
+			size_t len)
+{
+	struct st7305_emu_count *c;
+	int i;
+
+	mutex_lock(&emu->lock);
+
+	switch (cmd) {
+	case MIPI_DCS_SET_COLUMN_ADDRESS:
+		st7305_emu_window(&emu->xs, &emu->xe, data, len,
+				  ST7305_EMU_COLS);
+		break;
+	case MIPI_DCS_SET_PAGE_ADDRESS:
+		st7305_emu_window(&emu->ys, &emu->ye, data, len,
+				  ST7305_EMU_PAGES);
+		break;
+	case MIPI_DCS_SET_ADDRESS_MODE:
+		if (len)
+			emu->madctl = data[0];
+		break;
+	case MIPI_DCS_WRITE_MEMORY_START:
+		st7305_emu_write_start(emu);
+		fallthrough;
+	case MIPI_DCS_WRITE_MEMORY_CONTINUE:
+		st7305_emu_write(emu, data, len);
+		break;
+	case MIPI_DCS_ENTER_INVERT_MODE:
+	case MIPI_DCS_EXIT_INVERT_MODE:
+		emu->inverted = cmd == MIPI_DCS_ENTER_INVERT_MODE;
+		break;
+	case MIPI_DCS_SET_DISPLAY_ON:
+	case MIPI_DCS_SET_DISPLAY_OFF:
+		emu->display_on = cmd == MIPI_DCS_SET_DISPLAY_ON;
+		break;
+	case MIPI_DCS_ENTER_SLEEP_MODE:
+	case MIPI_DCS_EXIT_SLEEP_MODE:
+		emu->sleeping = cmd == MIPI_DCS_ENTER_SLEEP_MODE;
+		break;
+	case ST7305_EMU_HPM:
+	case ST7305_EMU_LPM:
+		emu->lpm = cmd == ST7305_EMU_LPM;
+		break;
+	}
+
+	for (i = 0, c = &emu->total; i < 2; i++, c = &emu->frame) {
+		c->commands++;
+		c->transfers += len ? 2 : 1;
+		c->bytes += 1 + len;
+		if (cmd == MIPI_DCS_WRITE_MEMORY_START ||
+		    cmd == MIPI_DCS_WRITE_MEMORY_CONTINUE)
+			c->ram_bytes += len;
+	}
+
+	mutex_unlock(&emu->lock);
+}
+
+/*
+ * The flush worker sent the last run of a flush. Everything counted since
+ * the previous call, all windows and runs included, becomes the last frame.
+ */
+void st7305_emu_frame_end(struct st7305_emu *emu)
+{
+	mutex_lock(&emu->lock);
+	emu->last_frame = emu->frame;
+	memset(&emu->frame, 0, sizeof(emu->frame));
+	emu->frames++;
+	mutex_unlock(&emu->lock);
+}
+
+size_t st7305_emu_pbm_size(const struct st7305_emu *emu)
+{
+	return 32 + DIV_ROUND_UP(emu->panel->width, 8) * emu->panel->height;
+}
+
+/* Set bits are white with INVON, the way the driver packs them */
+static bool st7305_emu_pixel(struct st7305_emu *emu, uint x, uint y)
+{
+	const struct st7305_panel *p = emu->panel;
+	uint tile_width = p->packer->tile_width;
+	uint rx = x + p->left_offset;
+	uint i = rx % tile_width;
+	u8 b, bit;
+
+	b = emu->ram[(p->raset[0] + y / 2) * ST7305_EMU_PAGE_BYTES +
+		     p->caset[0] * 3 + rx / tile_width];
+
+	/* ST7305 pairs take 2 bits per column, ST7306 pixels take 4 */
+	if (tile_width == 4)
+		bit = 7 - 2 * i - (y & 1);
+	else
+		bit = 7 - 4 * i - (y & 1);
+
+	return !!(b & BIT(bit)) == emu->inverted;
+}
+
+/*
+ * Binary PBM of the panel as the glass shows it, 1 is black. The mapping is
+ * the one the driver programs (MX | GS), other MADCTL values are only
+ * reported by st7305_emu_show(). Returns the number of bytes written to @buf,
+ * which holds st7305_emu_pbm_size() bytes.
+ */
+size_t st7305_emu_render_pbm(struct st7305_emu *emu, u8 *buf)
+{
+	const struct st7305_panel *p = emu->panel;
+	uint pitch = DIV_ROUND_UP(p->width, 8);
+	size_t n;
+	uint x, y;
+	u8 *row;
+
+	n = scnprintf((char *)buf, 32, "P4\n%u %u\n", p->width, p->height);
+	memset(buf + n, 0, pitch * p->height);
+
+	mutex_lock(&emu->lock);
+	for (y = 0; y < p->height; y++) {
+		row = buf + n + y * pitch;
+		for (x = 0; x < p->width; x++)
+			if (!emu->display_on || emu->sleeping ||
+			    !st7305_emu_pixel(emu, x, y))
+				row[x / 8] |= BIT(7 - x % 8);
+	}
+	mutex_unlock(&emu->lock);
+
+	return n + pitch * p->height;
+}
+
+static void st7305_emu_show_count(struct seq_file *m, const char *name,
+				  const struct st7305_emu_count *c)
+{
+	seq_printf(m, "%s: commands=%llu transfers=%llu bytes=%llu ram_bytes=%llu\n",
+		   name, c->commands, c->transfers, c->bytes, c->ram_bytes);
+}
+
+void st7305_emu_show(struct st7305_emu *emu, struct seq_file *m)
+{
+	mutex_lock(&emu->lock);
+	seq_printf(m, "caset: 0x%02x-0x%02x\n", emu->xs, emu->xe);
+	seq_printf(m, "raset: 0x%02x-0x%02x\n", emu->ys, emu->ye);
+	seq_printf(m, "madctl: 0x%02x\n", emu->madctl);
+	seq_printf(m, "display: %s%s%s%s\n", emu->display_on ? "on" : "off",
+		   emu->sleeping ? " sleep" : "",
+		   emu->inverted ? " inverted" : "",
+		   emu->lpm ? " lpm" : " hpm");
+	seq_printf(m, "frames: %llu\n", emu->frames);
+	st7305_emu_show_count(m, "total", &emu->total);
+	st7305_emu_show_count(m, "last_frame", &emu->last_frame);
+	st7305_emu_show_count(m, "frame", &emu->frame);
+	mutex_unlock(&emu->lock);
+}
@@ -0,0 +1,57 @@
+#ifndef __ST7305_EMU_H
+#define __ST7305_EMU_H
+
+#include <linux/mutex.h>
+#include <linux/types.h>
+
+/* Address space of the controller: 3 bytes per column address */
+#define ST7305_EMU_COLS 64
+#define ST7305_EMU_PAGES 256
+#define ST7305_EMU_PAGE_BYTES (ST7305_EMU_COLS * 3)
+
+struct device;
+struct seq_file;
+struct st7305_panel;
+
+struct st7305_emu_count {
+	u64 commands;
+	u64 transfers; // SPI transfers, the command byte and its parameters
+	u64 bytes; // on the wire, command bytes included
+	u64 ram_bytes; // memory write payload
+};
+
+/*
+ * Software model of the controller fed with the DCS stream the driver
+ * emits: address window, write pointer and display RAM, plus the mode
+ * commands that change what the glass shows.
+ */
+struct st7305_emu {
+	struct mutex lock; /* everything below */
+	const struct st7305_panel *panel;
+	u8 *ram;
+
+	u8 xs, xe, ys, ye; // CASET/RASET window
+	u8 col, page, byte; // write pointer
+	u8 madctl;
+	bool inverted;
+	bool display_on;
+	bool sleeping;
+	bool lpm;
+
+	/* a frame is one flush, see st7305_emu_frame_end() */
+	struct st7305_emu_count total;
+	struct st7305_emu_count frame;
+	struct st7305_emu_count last_frame;
+	u64 frames;
+};
+
+int st7305_emu_init(struct device *dev, struct st7305_emu *emu,
+		    const struct st7305_panel *panel);
+void st7305_emu_command(struct st7305_emu *emu, u8 cmd, const u8 *data,
+			size_t len);
+void st7305_emu_frame_end(struct st7305_emu *emu);
+size_t st7305_emu_pbm_size(const struct st7305_emu *emu);
+size_t st7305_emu_render_pbm(struct st7305_emu *emu, u8 *buf);
+void st7305_emu_show(struct st7305_emu *emu, struct seq_file *m);
+
+#endif /* __ST7305_EMU_H */
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Damage tracking and RAM windows of the st7305 driver
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <linux/device.h>
+#include <linux/kernel.h>
+#include <linux/string.h>
+
+#include <drm/drm_rect.h>
+
+#include "st7305-flush.h"
+#include "st7305-panel.h"
+#include "st7305_trace.h"
+
+int st7305_flush_init(struct device *dev, struct st7305_flush *fl,
+		      const struct st7305_panel *panel, unsigned int rotation)
+{
+	fl->panel = panel;
+	fl->rotation = rotation;
+
+	fl->shadow = devm_kmalloc(dev, st7305_panel_bufsize(panel),
+				  GFP_KERNEL);
+	if (!fl->shadow)
+		return -ENOMEM;
+
+	return 0;
+}
+
+/* Grow @r to the bounding box of @r and @a */
+void st7305_rect_union(struct drm_rect *r, const struct drm_rect *a)
+{
+	r->x1 = min(r->x1, a->x1);
+	r->y1 = min(r->y1, a->y1);
+	r->x2 = max(r->x2, a->x2);
+	r->y2 = max(r->y2, a->y2);
+}
+
+/* Translate a framebuffer rect into panel coordinates */
+static void st7305_rect_to_panel(const struct st7305_flush *fl,
+				 struct drm_rect *r)
+{
+	int w = fl->panel->width;
+	int h = fl->panel->height;
+	struct drm_rect f = *r;
+
+	switch (fl->rotation) {
+	case 90:
+		r->x1 = f.y1;
+		r->x2 = f.y2;
+		r->y1 = h - f.x2;
+		r->y2 = h - f.x1;
+		break;
+	case 180:
+		r->x1 = w - f.x2;
+		r->x2 = w - f.x1;
+		r->y1 = h - f.y2;
+		r->y2 = h - f.y1;
+		break;
+	case 270:
+		r->x1 = w - f.y2;
+		r->x2 = w - f.y1;
+		r->y1 = f.x1;
+		r->y2 = f.x2;
+		break;
+	}
+}
+
+/*
+ * Damage lands on an entry it overlaps or in a free slot, the last slot
+ * takes whatever does not fit.
+ */
+void st7305_add_damage(struct st7305_flush *fl, const struct drm_rect *clip)
+{
+	struct drm_rect o;
+	int i;
+
+	for (i = 0; i < fl->damage_nr; i++) {
+		o = fl->damage[i];
+		if (drm_rect_intersect(&o, clip)) {
+			st7305_rect_union(&fl->damage[i], clip);
+			return;
+		}
+	}
+
+	if (fl->damage_nr < ST7305_MAX_DAMAGE)
+		fl->damage[fl->damage_nr++] = *clip;
+	else
+		st7305_rect_union(&fl->damage[ST7305_MAX_DAMAGE - 1], clip);
+}
+
+/*
+ * Turn the damage @rect into the aligned panel clip to convert and the RAM
+ * window @win it lands in.
+ */
+void st7305_damage_to_window(const struct st7305_flush *fl,
+			     struct drm_rect *rect, struct drm_rect *win)
+{
+	st7305_rect_to_panel(fl, rect);
+	st7305_align_clip(fl->panel, rect);
+	st7305_clip_to_window(fl->panel, rect, win);
+}
+
+static long st7305_window_cost(const struct drm_rect *win)
+{
+	return ST7305_WINDOW_COST_BYTES +
+	       drm_rect_width(win) * ST7305_COL_BYTES * drm_rect_height(win);
+}
+
+/*
+ * Add the RAM window @win to the pending ones. Two windows are merged into
+ * their bounding box when that costs no more on the wire than sending them
+ * apart, overlapping ones always, so the runs of a flush never exceed
+ * win_buf. Past ST7305_MAX_WINDOWS the pair that loses least is merged.
+ */
+void st7305_add_window(struct st7305_flush *fl, const struct drm_rect *win)
+{
+	struct drm_rect *pending = fl->pending;
+	struct drm_rect u, o;
+	long gain, best;
+	int i, j, bi, bj;
+
+	pending[fl->pending_nr++] = *win;
+
+	while (fl->pending_nr > 1) {
+		best = LONG_MIN;
+		bi = 0;
+		bj = 0;
+		for (i = 0; i < fl->pending_nr; i++) {
+			for (j = i + 1; j < fl->pending_nr; j++) {
+				u = pending[i];
+				st7305_rect_union(&u, &pending[j]);
+				o = pending[i];
+				if (drm_rect_intersect(&o, &pending[j]))
+					gain = LONG_MAX;
+				else
+					gain = st7305_window_cost(&pending[i]) +
+					       st7305_window_cost(&pending[j]) -
+					       st7305_window_cost(&u);
+				if (gain > best) {
+					best = gain;
+					bi = i;
+					bj = j;
+				}
+			}
+		}
+
+		if (best < 0 && fl->pending_nr <= ST7305_MAX_WINDOWS)
+			break;
+
+		st7305_rect_union(&pending[bi], &pending[bj]);
+		pending[bj] = pending[--fl->pending_nr];
+	}
+}
+
+/* The panel RAM is unknown, the next flush resends all of it */
+void st7305_flush_all(struct st7305_flush *fl)
+{
+	fl->shadow_valid = false;
+	fl->pending[0].x1 = 0;
+	fl->pending[0].y1 = 0;
+	fl->pending[0].x2 = fl->panel->page_size / ST7305_COL_BYTES;
+	fl->pending[0].y2 = fl->panel->page_count;
+	fl->pending_nr = 1;
+}
+
+/* Word at a time compare, @a and @b must share the same alignment */
+static bool st7305_bytes_differ(const u8 *a, const u8 *b, size_t len)
+{
+	for (; len && !IS_ALIGNED((unsigned long)a, sizeof(long)); len--)
+		if (*a++ != *b++)
+			return true;
+
+	for (; len >= sizeof(long); len -= sizeof(long)) {
+		if (*(const unsigned long *)a != *(const unsigned long *)b)
+			return true;
+		a += sizeof(long);
+		b += sizeof(long);
+	}
+
+	for (; len; len--)
+		if (*a++ != *b++)
+			return true;
+
+	return false;
+}
+
+static bool st7305_page_changed(const struct st7305_flush *fl, const u8 *buf,
+				const struct drm_rect *win, int page)
+{
+	size_t offset = page * fl->panel->page_size +
+			win->x1 * ST7305_COL_BYTES;
+
+	if (!fl->shadow_valid)
+		return true;
+
+	return st7305_bytes_differ(buf + offset, fl->shadow + offset,
+				   drm_rect_width(win) * ST7305_COL_BYTES);
+}
+
+/*
+ * Diff the window @win of @buf against the shadow and collect the changed
+ * pages as at most @max runs, copied back to back to @tr, which the worker
+ * then sends while the next frame is converted into @buf. Short unchanged
+ * gaps are cheaper to resend than another RASET and memory write, the last
+ * run slot swallows whatever is left.
+ */
+static int st7305_collect_runs(struct st7305_flush *fl, const u8 *buf,
+			       const struct drm_rect *win,
+			       struct st7305_run *runs, int max, u8 **tr,
+			       size_t *skipped)
+{
+	const struct st7305_panel *panel = fl->panel;
+	size_t width = drm_rect_width(win) * ST7305_COL_BYTES;
+	size_t page_size = panel->page_size;
+	bool full = width == page_size && win->y1 == 0 &&
+		    win->y2 == panel->page_count;
+	int page, first, last, nr = 0;
+	size_t offset;
+
+	page = win->y1;
+	while (page < win->y2) {
+		if (!st7305_page_changed(fl, buf, win, page)) {
+			*skipped += width;
+			page++;
+			continue;
+		}
+
+		first = page;
+		last = page;
+		for (page++; page < win->y2; page++) {
+			if (st7305_page_changed(fl, buf, win, page))
+				last = page;
+			else if (nr < max - 1 &&
+				 (page - last) * width > ST7305_RUN_GAP_BYTES)
+				break;
+		}
+		/* unchanged pages compared after the run, rechecked if broken */
+		*skipped += (page - last - 1) * width;
+
+		runs[nr].x1 = win->x1;
+		runs[nr].x2 = win->x2;
+		runs[nr].first = first;
+		runs[nr].last = last;
+		nr++;
+
+		offset = first * page_size + win->x1 * ST7305_COL_BYTES;
+		for (; first <= last; first++, offset += page_size) {
+			memcpy(*tr, buf + offset, width);
+			memcpy(fl->shadow + offset, buf + offset, width);
+			*tr += width;
+		}
+	}
+
+	if (full)
+		fl->shadow_valid = true;
+
+	return nr;
+}
+
+/*
+ * Collect the runs of all pending windows of the converted frame @buf into
+ * @runs and their payload into @tr, then forget the windows. At most
+ * ST7305_MAX_RUNS runs are returned, the unchanged bytes left out are added
+ * to @skipped.
+ */
+int st7305_flush_runs(struct st7305_flush *fl, const u8 *buf,
+		      struct st7305_run *runs, u8 *tr, size_t *skipped)
+{
+	const struct drm_rect *win;
+	int i, n, nr = 0;
+	u8 *win_start;
+
+	/* every window keeps at least one run slot */
+	for (i = 0; i < fl->pending_nr; i++) {
+		win = &fl->pending[i];
+		win_start = tr;
+		n = st7305_collect_runs(fl, buf, win, runs + nr,
+					ST7305_MAX_RUNS - nr -
+					(fl->pending_nr - i - 1), &tr,
+					skipped);
+		if (n)
+			trace_st7305_flush(win, n, tr - win_start);
+		nr += n;
+	}
+	fl->pending_nr = 0;
+
+	return nr;
+}
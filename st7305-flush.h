@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __ST7305_FLUSH_H
+#define __ST7305_FLUSH_H
+
+#include <linux/types.h>
+
+#include <drm/drm_rect.h>
+
+struct device;
+struct st7305_panel;
+
+/* Unchanged bytes worth resending to save a RASET and a memory write */
+#define ST7305_RUN_GAP_BYTES 128
+#define ST7305_MAX_RUNS 16
+
+/*
+ * Payload bytes a separate RAM window has to save to pay for its CASET,
+ * RASET and memory write, see st7305_add_window()
+ */
+#define ST7305_WINDOW_COST_BYTES 192
+#define ST7305_MAX_WINDOWS 4
+/* Damage clips taken from a plane update, the rest is merged */
+#define ST7305_MAX_DAMAGE 16
+
+/* Pages [first, last] of RAM columns [x1, x2), see st7305_collect_runs() */
+struct st7305_run {
+	u16 x1;
+	u16 x2;
+	u16 first;
+	u16 last;
+};
+
+/*
+ * Damage and RAM window bookkeeping between the plane updates and the
+ * flush worker. The caller serializes access, the driver with buf_lock.
+ */
+struct st7305_flush {
+	const struct st7305_panel *panel;
+	unsigned int rotation; // of the framebuffer, counter clockwise
+
+	/* what the panel RAM holds, valid after a full frame went out */
+	u8 *shadow;
+	bool shadow_valid;
+
+	/* damage not converted yet, framebuffer coordinates */
+	struct drm_rect damage[ST7305_MAX_DAMAGE];
+	int damage_nr;
+	/* RAM windows, see st7305_clip_to_window(), one spare for merging */
+	struct drm_rect pending[ST7305_MAX_WINDOWS + 1];
+	int pending_nr;
+};
+
+int st7305_flush_init(struct device *dev, struct st7305_flush *fl,
+		      const struct st7305_panel *panel, unsigned int rotation);
+void st7305_rect_union(struct drm_rect *r, const struct drm_rect *a);
+void st7305_add_damage(struct st7305_flush *fl, const struct drm_rect *clip);
+void st7305_damage_to_window(const struct st7305_flush *fl,
+			     struct drm_rect *rect, struct drm_rect *win);
+void st7305_add_window(struct st7305_flush *fl, const struct drm_rect *win);
+void st7305_flush_all(struct st7305_flush *fl);
+int st7305_flush_runs(struct st7305_flush *fl, const u8 *buf,
+		      struct st7305_run *runs, u8 *tr, size_t *skipped);
+
+#endif /* __ST7305_FLUSH_H */
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * NEON accelerated conversion and packing for the st7305 driver
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <arm_neon.h>
+
+#include "st7305-neon.h"
+
+/*
+ * 16 pixels per iteration: deinterleave XRGB8888, BT.601 luma in 16 bits,
+ * divide by 10 with a multiply-high ((v * 6554) >> 16 is exact for
+ * v <= 2550) and compare against the threshold row.
+ */
+void dither_neon_xrgb8888_to_bw(unsigned char *dst, const void *src,
+				const unsigned char *row, unsigned int order,
+				unsigned int x, unsigned int n)
+{
+	const uint8_t *s = src;
+	uint8x16_t thr = vdupq_n_u8(row[0]);
+	unsigned int i, k;
+
+	if (order < 16) {
+		uint8_t t[16];
+
+		for (k = 0; k < 16; k++)
+			t[k] = row[(x + k) & (order - 1)];
+		thr = vld1q_u8(t);
+	}
+
+	for (i = 0; i < n; i += 16, s += 64) {
+		uint8x16x4_t px = vld4q_u8(s); /* B, G, R, X */
+		uint16x8_t lo, hi;
+		uint8x16_t gray;
+
+		lo = vmull_u8(vget_low_u8(px.val[2]), vdup_n_u8(3));
+		lo = vmlal_u8(lo, vget_low_u8(px.val[1]), vdup_n_u8(6));
+		lo = vaddw_u8(lo, vget_low_u8(px.val[0]));
+		hi = vmull_u8(vget_high_u8(px.val[2]), vdup_n_u8(3));
+		hi = vmlal_u8(hi, vget_high_u8(px.val[1]), vdup_n_u8(6));
+		hi = vaddw_u8(hi, vget_high_u8(px.val[0]));
+
+		lo = vcombine_u16(
+			vshrn_n_u32(vmull_n_u16(vget_low_u16(lo), 6554), 16),
+			vshrn_n_u32(vmull_n_u16(vget_high_u16(lo), 6554), 16));
+		hi = vcombine_u16(
+			vshrn_n_u32(vmull_n_u16(vget_low_u16(hi), 6554), 16),
+			vshrn_n_u32(vmull_n_u16(vget_high_u16(hi), 6554), 16));
+		gray = vcombine_u8(vmovn_u16(lo), vmovn_u16(hi));
+
+		if (order >= 16)
+			thr = vld1q_u8(row + ((x + i) & (order - 1)));
+
+		vst1q_u8(dst + i, vcgtq_u8(gray, thr));
+	}
+}
+
+/* Same for 8-bit gray, 16 pixels per iteration */
+void dither_neon_gray8_to_bw(unsigned char *dst, const unsigned char *src,
+			     const unsigned char *row, unsigned int order,
+			     unsigned int x, unsigned int n)
+{
+	uint8x16_t thr = vdupq_n_u8(row[0]);
+	unsigned int i, k;
+
+	if (order < 16) {
+		uint8_t t[16];
+
+		for (k = 0; k < 16; k++)
+			t[k] = row[(x + k) & (order - 1)];
+		thr = vld1q_u8(t);
+	}
+
+	for (i = 0; i < n; i += 16) {
+		if (order >= 16)
+			thr = vld1q_u8(row + ((x + i) & (order - 1)));
+
+		vst1q_u8(dst + i, vcgtq_u8(vld1q_u8(src + i), thr));
+	}
+}
+
+/* Bit 7 of the even row and bit 6 of the odd row, per pixel column */
+static inline uint8x16_t neon_pair_bits(const uint8_t *r0, const uint8_t *r1)
+{
+	uint8x16_t hi = vandq_u8(vld1q_u8(r0), vdupq_n_u8(0x80));
+	uint8x16_t lo = vandq_u8(vld1q_u8(r1), vdupq_n_u8(0x80));
+
+	return vorrq_u8(hi, vshrq_n_u8(lo, 1));
+}
+
+/*
+ * ST7305: four column pairs per byte, shift each pair into place and fold
+ * neighbours together with pairwise adds (bits never overlap).
+ */
+void st7305_neon_pack_tiles(unsigned char *dst, const unsigned char *row0,
+			    const unsigned char *row1, unsigned int n)
+{
+	static const int8_t shifts[16] = { 0, -2, -4, -6, 0, -2, -4, -6,
+					   0, -2, -4, -6, 0, -2, -4, -6 };
+	int8x16_t sh = vld1q_s8(shifts);
+	unsigned int i;
+
+	for (i = 0; i < n; i += 32, dst += 8) {
+		uint8x16_t a = vshlq_u8(neon_pair_bits(row0 + i, row1 + i), sh);
+		uint8x16_t b = vshlq_u8(
+			neon_pair_bits(row0 + i + 16, row1 + i + 16), sh);
+		uint32x4_t wa = vpaddlq_u16(vpaddlq_u8(a));
+		uint32x4_t wb = vpaddlq_u16(vpaddlq_u8(b));
+
+		vst1_u8(dst, vmovn_u16(vcombine_u16(vmovn_u32(wa),
+						    vmovn_u32(wb))));
+	}
+}
+
+/* ST7306: two column pairs per byte, each pixel duplicated two bits down */
+void st7306_neon_pack_tiles(unsigned char *dst, const unsigned char *row0,
+			    const unsigned char *row1, unsigned int n)
+{
+	static const int8_t shifts[16] = { 0, -4, 0, -4, 0, -4, 0, -4,
+					   0, -4, 0, -4, 0, -4, 0, -4 };
+	int8x16_t sh = vld1q_s8(shifts);
+	unsigned int i;
+
+	for (i = 0; i < n; i += 16, dst += 8) {
+		uint8x16_t a = vshlq_u8(neon_pair_bits(row0 + i, row1 + i), sh);
+		uint8x8_t b = vmovn_u16(vpaddlq_u8(a));
+
+		vst1_u8(dst, vorr_u8(b, vshr_n_u8(b, 2)));
+	}
+}
@@ -0,0 +1,25 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __ST7305_NEON_H
+#define __ST7305_NEON_H
+
+/*
+ * NEON kernels, built with NEON code generation enabled. The translation
+ * unit only includes <arm_neon.h>, so plain C types are used here instead
+ * of the kernel ones.
+ *
+ * All of them must be called between kernel_neon_begin() and
+ * kernel_neon_end(), @n is a multiple of 16 for the dither kernels and of
+ * 32 / 16 pixels for the ST7305 / ST7306 packers.
+ */
+void dither_neon_xrgb8888_to_bw(unsigned char *dst, const void *src,
+				const unsigned char *row, unsigned int order,
+				unsigned int x, unsigned int n);
+void dither_neon_gray8_to_bw(unsigned char *dst, const unsigned char *src,
+			     const unsigned char *row, unsigned int order,
+			     unsigned int x, unsigned int n);
+void st7305_neon_pack_tiles(unsigned char *dst, const unsigned char *row0,
+			    const unsigned char *row1, unsigned int n);
+void st7306_neon_pack_tiles(unsigned char *dst, const unsigned char *row0,
+			    const unsigned char *row1, unsigned int n);
+
+#endif /* __ST7305_NEON_H */
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Packing of black/white scanlines into the ST7305/ST7306 display RAM
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+
+#include "st7305-neon.h"
+#include "st7305-pack.h"
+
+/*
+ * ST7305 RAM layout: one byte holds a 4x2 tile, columns from MSB to LSB,
+ * with the even row in the higher bit of each pair.
+ */
+static inline u8 st7305_pack_tile(const u8 *r0, const u8 *r1)
+{
+	return (r0[0] & 0x80) | ((r1[0] & 0x80) >> 1) |
+	       ((r0[1] & 0x80) >> 2) | ((r1[1] & 0x80) >> 3) |
+	       ((r0[2] & 0x80) >> 4) | ((r1[2] & 0x80) >> 5) |
+	       ((r0[3] & 0x80) >> 6) | ((r1[3] & 0x80) >> 7);
+}
+
+/*
+ * ST7306 RAM layout: one byte holds a 2x2 tile, each pixel occupies two
+ * bits (mono panels drive both sub-pixels with the same value).
+ */
+static inline u8 st7306_pack_tile(const u8 *r0, const u8 *r1)
+{
+	u8 b = (r0[0] & 0x80) | ((r1[0] & 0x80) >> 1) |
+	       ((r0[1] & 0x80) >> 4) | ((r1[1] & 0x80) >> 5);
+
+	return b | (b >> 2);
+}
+
+/*
+ * Pack one page (two rows) of pixels into panel RAM bytes. @row0 and @row1
+ * hold one byte per pixel for columns [@x1, @x2), only bit 7 is used.
+ * Every destination byte touched is written exactly once, pixels of a
+ * partial tile that fall outside [@x1, @x2) are cleared, so callers must
+ * pass a clip aligned with st7305_align_clip().
+ */
+static __always_inline void
+st730x_pack_page(u8 *dst, const u8 *row0, const u8 *row1, uint x1, uint x2,
+		 u8 left_offset, const uint tw,
+		 u8 (*pack_tile)(const u8 *r0, const u8 *r1),
+		 void (*pack_bulk)(u8 *dst, const u8 *r0, const u8 *r1, uint n),
+		 const uint bulk)
+{
+	uint x = x1 + left_offset;
+	uint end = x2 + left_offset;
+	u8 t0[4], t1[4];
+	uint head, n;
+
+	dst += x / tw;
+
+	head = x % tw;
+	if (head) {
+		n = min(tw - head, end - x);
+		memset(t0, 0, sizeof(t0));
+		memset(t1, 0, sizeof(t1));
+		memcpy(t0 + head, row0, n);
+		memcpy(t1 + head, row1, n);
+		*dst++ = pack_tile(t0, t1);
+		row0 += n;
+		row1 += n;
+		x += n;
+	}
+
+	if (pack_bulk) {
+		n = round_down(end - x, bulk);
+		pack_bulk(dst, row0, row1, n);
+		dst += n / tw;
+		row0 += n;
+		row1 += n;
+		x += n;
+	}
+
+	for (; x + tw <= end; x += tw, row0 += tw, row1 += tw)
+		*dst++ = pack_tile(row0, row1);
+
+	if (x < end) {
+		n = end - x;
+		memset(t0, 0, sizeof(t0));
+		memset(t1, 0, sizeof(t1));
+		memcpy(t0, row0, n);
+		memcpy(t1, row1, n);
+		*dst = pack_tile(t0, t1);
+	}
+}
+
+static void st7305_pack_page(u8 *dst, const u8 *row0, const u8 *row1,
+			     uint x1, uint x2, u8 left_offset)
+{
+	st730x_pack_page(dst, row0, row1, x1, x2, left_offset, 4,
+			 st7305_pack_tile, NULL, 0);
+}
+
+static void st7306_pack_page(u8 *dst, const u8 *row0, const u8 *row1,
+			     uint x1, uint x2, u8 left_offset)
+{
+	st730x_pack_page(dst, row0, row1, x1, x2, left_offset, 2,
+			 st7306_pack_tile, NULL, 0);
+}
+
+#ifdef CONFIG_KERNEL_MODE_NEON
+static void st7305_pack_page_neon(u8 *dst, const u8 *row0, const u8 *row1,
+				  uint x1, uint x2, u8 left_offset)
+{
+	st730x_pack_page(dst, row0, row1, x1, x2, left_offset, 4,
+			 st7305_pack_tile, st7305_neon_pack_tiles, 32);
+}
+
+static void st7306_pack_page_neon(u8 *dst, const u8 *row0, const u8 *row1,
+				  uint x1, uint x2, u8 left_offset)
+{
+	st730x_pack_page(dst, row0, row1, x1, x2, left_offset, 2,
+			 st7306_pack_tile, st7306_neon_pack_tiles, 16);
+}
+#else
+#define st7305_pack_page_neon NULL
+#define st7306_pack_page_neon NULL
+#endif
+
+const struct st7305_packer st7305_packer = {
+	.tile_width = 4,
+	.pack_page = st7305_pack_page,
+	.pack_page_neon = st7305_pack_page_neon,
+};
+
+const struct st7305_packer st7306_packer = {
+	.tile_width = 2,
+	.pack_page = st7306_pack_page,
+	.pack_page_neon = st7306_pack_page_neon,
+};
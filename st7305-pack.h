@@ -0,0 +1,21 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __ST7305_PACK_H
+#define __ST7305_PACK_H
+
+#include <linux/types.h>
+
+/* Display RAM layout of a controller */
+struct st7305_packer {
+	u8 tile_width; // pixel columns packed into one RAM byte
+
+	void (*pack_page)(u8 *dst, const u8 *row0, const u8 *row1, uint x1,
+			  uint x2, u8 left_offset);
+	/* must be called between kernel_neon_begin() and kernel_neon_end() */
+	void (*pack_page_neon)(u8 *dst, const u8 *row0, const u8 *row1,
+			       uint x1, uint x2, u8 left_offset);
+};
+
+extern const struct st7305_packer st7305_packer;
+extern const struct st7305_packer st7306_packer;
+
+#endif /* __ST7305_PACK_H */
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Display RAM geometry of the panels driven by the st7305 driver
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <linux/kernel.h>
+
+#include <drm/drm_rect.h>
+
+#include "st7305-pack.h"
+#include "st7305-panel.h"
+
+const struct st7305_panel ydp154h008_v3_panel = {
+	.name = "ydp154h008_v3",
+	.width = 200,
+	.height = 200,
+	.width_mm = 28,
+	.height_mm = 28,
+
+	.caset[0] = 0x16,
+	.caset[1] = 0x26,
+
+	.raset[0] = 0x00,
+	.raset[1] = 0x63,
+
+	.left_offset = 4,
+
+	.page_size = 51, // 200/8*2=50≈51 (3 bytes per write)
+	.page_count = 100, // 200/2=100
+
+	.packer = &st7305_packer,
+};
+
+const struct st7305_panel ydp213h001_v3_panel = {
+	.name = "ydp213h001_v3",
+	.width = 122,
+	.height = 250,
+	.width_mm = 24,
+	.height_mm = 49,
+
+	.caset[0] = 0x19,
+	.caset[1] = 0x23,
+
+	.raset[0] = 0x00,
+	.raset[1] = 0x7C,
+
+	.left_offset = 10,
+
+	.page_size = 33, // 122/4=30.5≈33 (3 bytes per write)
+	.page_count = 125, // 252/2=125
+
+	.packer = &st7305_packer,
+};
+
+const struct st7305_panel ydp290h001_v3_panel = {
+	.name = "ydp290h001_v3",
+	.width = 168,
+	.height = 384,
+	.width_mm = 29,
+	.height_mm = 67,
+
+	.caset[0] = 0x17,
+	.caset[1] = 0x24, // 0X24-0X17=14 // 14*4*3=168
+
+	.raset[0] = 0x00,
+	.raset[1] = 0xBF, // 192*2=384
+
+	.left_offset = 0,
+
+	.page_size = 42, // 168/8*2=42
+	.page_count = 192,
+
+	.packer = &st7305_packer,
+};
+
+const struct st7305_panel w420hc018mono_12z_panel = {
+	.name = "w420hc018mono_12z",
+	.width = 300,
+	.height = 400,
+	.width_mm = 64,
+	.height_mm = 85,
+
+	.caset[0] = 0x05,
+	.caset[1] = 0x36,
+
+	.raset[0] = 0x00,
+	.raset[1] = 0xC7,
+
+	.left_offset = 144,
+
+	.page_size = 150,
+	.page_count = 200,
+
+	.packer = &st7305_packer,
+};
+
+const struct st7305_panel ydp420h001_v3_panel = {
+	.name = "ydp420h001_v3",
+	.width = 300,
+	.height = 400,
+	.width_mm = 64,
+	.height_mm = 85,
+
+	.caset[0] = 0x05,
+	.caset[1] = 0x36,
+
+	.raset[0] = 0x00,
+	.raset[1] = 0xC7,
+
+	.left_offset = 0,
+
+	.page_size = 150,
+	.page_count = 200,
+
+	/*
+	 * The ST7306 supports multi-color displays, and while its internal
+	 * display RAM layout differs slightly from the ST7305, the two are
+	 * otherwise largely compatible.
+	 */
+	.packer = &st7306_packer,
+};
+
+/*
+ * All controller alignment constraints live here: @clip is grown to whole
+ * column addresses (3 RAM bytes) and whole pages (2 rows). This keeps the
+ * packers, which rewrite complete bytes, from clearing pixels outside of
+ * the damaged area and gives a clip that maps exactly onto a CASET/RASET
+ * window, see st7305_clip_to_window().
+ */
+void st7305_align_clip(const struct st7305_panel *panel,
+		       struct drm_rect *clip)
+{
+	int col_px = ST7305_COL_BYTES * panel->packer->tile_width;
+	int off = panel->left_offset;
+
+	clip->x1 = max(rounddown(clip->x1 + off, col_px) - off, 0);
+	clip->x2 = min(roundup(clip->x2 + off, col_px) - off,
+		       (int)panel->width);
+	clip->y1 = round_down(clip->y1, 2);
+	clip->y2 = min(round_up(clip->y2, 2), (int)panel->height);
+}
+
+/*
+ * Translate an aligned clip into a RAM window, x in column addresses and y
+ * in pages, both relative to the panel's caset[0]/raset[0].
+ */
+void st7305_clip_to_window(const struct st7305_panel *panel,
+			   const struct drm_rect *clip, struct drm_rect *win)
+{
+	int col_px = ST7305_COL_BYTES * panel->packer->tile_width;
+	int off = panel->left_offset;
+
+	win->x1 = (clip->x1 + off) / col_px;
+	win->x2 = DIV_ROUND_UP(clip->x2 + off, col_px);
+	win->y1 = clip->y1 / 2;
+	win->y2 = DIV_ROUND_UP(clip->y2, 2);
+}
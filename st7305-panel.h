@@ -0,0 +1,48 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __ST7305_PANEL_H
+#define __ST7305_PANEL_H
+
+#include <linux/types.h>
+
+/* One column address (CASET unit) covers 3 bytes of display RAM */
+#define ST7305_COL_BYTES 3
+
+struct drm_rect;
+struct st7305_packer;
+
+/* How the glass of a panel maps onto the display RAM */
+struct st7305_panel {
+	const char *name;
+	u16 width;
+	u16 height;
+	u16 width_mm;
+	u16 height_mm;
+
+	u8 caset[2]; // column address start->end
+	u8 raset[2]; // row address start->end
+
+	u8 left_offset; // offset pixels from the left
+
+	u8 page_size; // each page contains two rows
+	u8 page_count;
+
+	const struct st7305_packer *packer;
+};
+
+extern const struct st7305_panel ydp154h008_v3_panel;
+extern const struct st7305_panel ydp213h001_v3_panel;
+extern const struct st7305_panel ydp290h001_v3_panel;
+extern const struct st7305_panel w420hc018mono_12z_panel;
+extern const struct st7305_panel ydp420h001_v3_panel;
+
+static inline size_t st7305_panel_bufsize(const struct st7305_panel *panel)
+{
+	return panel->page_size * panel->page_count;
+}
+
+void st7305_align_clip(const struct st7305_panel *panel,
+		       struct drm_rect *clip);
+void st7305_clip_to_window(const struct st7305_panel *panel,
+			   const struct drm_rect *clip, struct drm_rect *win);
+
+#endif /* __ST7305_PANEL_H */
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Cheap latency histograms for the st7305 driver
+ *
+ * Copyright (c) 2025 Wooden Chair <hua.zheng@embeddedboys.com>
+ */
+
+#include <linux/kernel.h>
+#include <linux/log2.h>
+#include <linux/string.h>
+
+#include "st7305-stats.h"
+
+#define SUB ST7305_HIST_SUB_BITS
+
+static uint st7305_hist_bucket(u64 v)
+{
+	uint e;
+
+	if (v < BIT(SUB))
+		return v;
+
+	e = ilog2(v);
+	return ((e - SUB + 1) << SUB) + ((v >> (e - SUB)) & (BIT(SUB) - 1));
+}
+
+/* Largest value that lands in bucket @i */
+static u64 st7305_hist_bucket_max(uint i)
+{
+	uint e;
+
+	if (i < BIT(SUB))
+		return i;
+
+	e = (i >> SUB) + SUB - 1;
+	return ((u64)(BIT(SUB) + (i & (BIT(SUB) - 1))) << (e - SUB)) +
+	       BIT_ULL(e - SUB) - 1;
+}
+
+void st7305_hist_reset(struct st7305_hist *h)
+{
+	memset(h, 0, sizeof(*h));
+	h->min = U64_MAX;
+}
+
+void st7305_hist_add(struct st7305_hist *h, u64 v)
+{
+	h->count++;
+	h->sum += v;
+	h->min = min(h->min, v);
+	h->max = max(h->max, v);
+	h->buckets[st7305_hist_bucket(v)]++;
+}
+
+/* Upper bound of the bucket holding the @pct percentile, capped by max */
+u64 st7305_hist_percentile(const struct st7305_hist *h, uint pct)
+{
+	u64 target, seen = 0;
+	uint i;
+
+	if (!h->count)
+		return 0;
+
+	target = DIV_ROUND_UP_ULL(h->count * pct, 100);
+	for (i = 0; i < ST7305_HIST_BUCKETS; i++) {
+		seen += h->buckets[i];
+		if (seen >= target)
+			return min(st7305_hist_bucket_max(i), h->max);
+	}
+
+	return h->max;
+}
@@ -0,0 +1,25 @@
+#ifndef __ST7305_STATS_H
+#define __ST7305_STATS_H
+
+#include <linux/types.h>
+
+/*
+ * Log-linear histogram: four buckets per power of two, so any percentile is
+ * within 25% of the recorded value. Values below 4 get a bucket each.
+ */
+#define ST7305_HIST_SUB_BITS 2
+#define ST7305_HIST_BUCKETS (64 << ST7305_HIST_SUB_BITS)
+
+struct st7305_hist {
+	u64 count;
+	u64 sum;
+	u64 min;
+	u64 max;
+	u32 buckets[ST7305_HIST_BUCKETS];
+};
+
+void st7305_hist_reset(struct st7305_hist *h);
+void st7305_hist_add(struct st7305_hist *h, u64 v);
+u64 st7305_hist_percentile(const struct st7305_hist *h, uint pct);
+
+#endif /* __ST7305_STATS_H */
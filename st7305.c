@@ -11,27 +11,50 @@
  */
 
 #include <linux/backlight.h>
+#include <linux/debugfs.h>
 #include <linux/delay.h>
 #include <linux/dma-buf.h>
+#include <linux/dma-mapping.h>
 #include <linux/gpio/consumer.h>
+#include <linux/ktime.h>
+#include <linux/mm.h>
 #include <linux/module.h>
+#include <linux/pm_runtime.h>
 #include <linux/property.h>
+#include <linux/seq_file.h>
+#include <linux/sizes.h>
 #include <linux/spi/spi.h>
+#include <linux/workqueue.h>
 #include <video/mipi_display.h>
 
+#ifdef CONFIG_KERNEL_MODE_NEON
+#include <asm/neon.h>
+#endif
+
 #include <drm/drm_atomic_helper.h>
 #include <drm/drm_damage_helper.h>
 #include <drm/drm_drv.h>
 #include <drm/drm_fb_cma_helper.h>
 #include <drm/drm_fb_helper.h>
-#include <drm/drm_format_helper.h>
+#include <drm/drm_fourcc.h>
 #include <drm/drm_gem_cma_helper.h>
 #include <drm/drm_gem_framebuffer_helper.h>
+#include <drm/drm_gem_shmem_helper.h>
 #include <drm/drm_managed.h>
-#include <drm/drm_mipi_dbi.h>
 #include <drm/drm_rect.h>
+#include <drm/drm_vblank.h>
 
 #include "dither.h"
+#include "drm_mipi_dbi.h"
+#include "st7305-convert.h"
+#include "st7305-emu.h"
+#include "st7305-flush.h"
+#include "st7305-pack.h"
+#include "st7305-panel.h"
+#include "st7305-stats.h"
+
+#define CREATE_TRACE_POINTS
+#include "st7305_trace.h"
 
 #define DRV_NAME "st7305"
 
@@ -41,37 +64,135 @@
 #define ST7305_MADCTL_DO BIT(4) // Data Order, using in MX=1
 #define ST7305_MADCTL_GS BIT(3) // Data refresh Bottom to Top
 
+#define ST7305_HPM 0x38 // High Power Mode on
+#define ST7305_LPM 0x39 // Low Power Mode on
+
+/* After a sleep-out: until the next command, until a sleep-in is allowed */
+#define ST7305_SLPOUT_CMD_MS 5
+#define ST7305_SLPOUT_SLPIN_MS 120
+/* Display off to sleep-in, a quick blank/unblank keeps the panel awake */
+#define ST7305_AUTOSUSPEND_MS 2000
+
+/* TE periods timed to derive the mode clock, see st7305_te_worker() */
+#define ST7305_TE_SAMPLES 8
+#define ST7305_TE_TIMEOUT_MS 1000
+
+/* Histograms in debugfs "stats", times in ns */
+enum st7305_stat {
+	ST7305_STAT_COPY, // st7305_buf_copy(), convert and pack included
+	ST7305_STAT_CONVERT, // gray conversion and dithering, one fused pass
+	ST7305_STAT_PACK,
+	ST7305_STAT_TE_WAIT,
+	ST7305_STAT_CMD, // CASET and RASET
+	ST7305_STAT_SPI, // memory writes, until the last run landed
+	ST7305_STAT_DAMAGE, // pixels per damage rect
+	ST7305_STAT_BYTES, // bytes per flush
+	ST7305_STAT_MAX,
+};
+
+static bool use_neon = true;
+module_param(use_neon, bool, 0644);
+MODULE_PARM_DESC(use_neon, "Use NEON for conversion when available (default: true)");
+
+static bool emulate;
+module_param(emulate, bool, 0444);
+MODULE_PARM_DESC(emulate, "Decode the command stream into a virtual panel instead of driving the bus (default: false)");
+
+#if IS_ENABLED(CONFIG_DRM_GEM_SHMEM_HELPER)
+static bool gem_shmem;
+module_param(gem_shmem, bool, 0444);
+MODULE_PARM_DESC(gem_shmem, "Back framebuffers with cached shmem instead of write-combined CMA (default: false)");
+#else
+#define gem_shmem false
+#endif
+
 struct st7305 {
 	struct device *dev;
 	struct mipi_dbi_dev *dbidev;
 	struct mipi_dbi *dbi;
 	struct drm_device *drm;
 
-	/* TODO: support TE */
+	/* TE edges pace the flush and drive the vblank counter */
 	struct gpio_desc *te;
 	struct completion refresh_done;
+	ktime_t te_stamp; // last TE edge
+	u32 te_count;
+	u32 te_mhz; // measured HPM refresh rate, 0 until known
+	int te_irq;
+	/* the first edges after an enable are timed, see st7305_te_worker() */
+	struct delayed_work te_work;
+	bool te_measuring;
+	bool te_failed; // no TE, don't wait for it again on every enable
+	ktime_t te_first_stamp; // 0 until the first timed edge
+	u32 te_first;
 
 	u8 dither_type;
+	bool redraw; // dither type changed, convert the next frame in full
+	struct st7305_convert conv; // used under buf_lock
+	/* contiguous copy of a partial RAM window for the transfer */
+	u8 *win_buf;
+
+	/*
+	 * Commits only record damage. The worker converts it into tx_buf,
+	 * copies the changed runs into win_buf and sends them from there.
+	 */
+	struct delayed_work flush_work;
+	unsigned int max_fps; // flush rate limit, 0 flushes every commit
+	struct mutex buf_lock; /* tx_buf, damage_fb and flush */
+	struct drm_framebuffer *damage_fb; // newest framebuffer with damage
+	struct st7305_flush flush; // damage, pending windows and the shadow
+	/* the last run may still be on the bus when the worker returns */
+	struct mipi_dbi_async flush_async;
+	int flush_error;
+	/* page flip event waiting for the worker, under buf_lock */
+	struct drm_pending_vblank_event *event;
+	/* handed over with the last run, sent by st7305_flush_done() */
+	struct drm_pending_vblank_event *flush_event;
+
+	u64 bytes_sent;
+	u64 bytes_skipped;
+	u64 frames_coalesced;
+
+	spinlock_t stats_lock; /* also taken from the SPI completion */
+	struct st7305_hist stats[ST7305_STAT_MAX];
+	ktime_t spi_start; // last run submitted, 0 once accounted
+	u64 spi_ns; // runs before the last one
+
+	/* HPM/LPM governor, see st7305_idle_worker() */
+	struct delayed_work idle_work;
+	unsigned int idle_ms; // 0 keeps the panel in HPM
+	struct mutex pm_lock; /* the fields below */
+	bool pm_active; // display is on, the power mode is known
+	bool lpm;
+	unsigned long last_update; // jiffies, start of the last flush
+	ktime_t pm_since;
+	u64 hpm_us;
+	u64 lpm_us;
+	u64 pm_transitions;
+	s64 lpm_enter_us, lpm_enter_max_us;
+	s64 lpm_exit_us, lpm_exit_max_us;
+	/* runtime PM, see st7305_runtime_suspend() */
+	bool panel_ready; // initialized, the RAM matches the shadow
+	bool asleep;
+	ktime_t sleep_out;
+	u64 resume_cold;
+	u64 resume_fast;
+
+	/* blank to visible of the last enable, see st7305_resume_done() */
+	bool resuming;
+	ktime_t resume_start;
+	s64 resume_us;
+	u64 resume_bytes; // RAM bytes sent while resuming, under stats_lock
+
+	/* virtual panel fed with every command, see the emulate parameter */
+	struct st7305_emu *emu;
 
 	const struct st7305_panel_desc *desc;
 };
 
 struct st7305_panel_desc {
-	const struct drm_display_mode *mode;
-
-	u8 caset[2]; // column address start->end
-	u8 raset[2]; // row address start->end
-
-	u8 left_offset; // offset pixels from the left
-
-	u8 page_size; // each page contains two rows
-	u8 page_count;
-
-	size_t bufsize;
-
-	int (*init_seq)(struct st7305 *st7305);
-	void (*draw_pixel)(u8 *dst, uint x, uint y, u8 left_offset,
-			   u8 page_size, u8 gray);
+	const struct st7305_panel *panel; // RAM geometry, see st7305-panel.c
+	const u8 *init_table; // panel specific, sent after display on
 };
 
 static inline struct st7305 *dbi_to_st7305(struct mipi_dbi *dbi)
@@ -84,6 +205,57 @@ static inline struct st7305 *dbidev_to_st7305(struct mipi_dbi_dev *dbidev)
 	return dbi_to_st7305(&dbidev->dbi);
 }
 
+static void st7305_stat(struct st7305 *st7305, enum st7305_stat stat, u64 v)
+{
+	unsigned long flags;
+
+	spin_lock_irqsave(&st7305->stats_lock, flags);
+	st7305_hist_add(&st7305->stats[stat], v);
+	spin_unlock_irqrestore(&st7305->stats_lock, flags);
+}
+
+/* The counters are cleared from debugfs under stats_lock as well */
+static void st7305_count(struct st7305 *st7305, u64 *counter, u64 v)
+{
+	unsigned long flags;
+
+	spin_lock_irqsave(&st7305->stats_lock, flags);
+	*counter += v;
+	spin_unlock_irqrestore(&st7305->stats_lock, flags);
+}
+
+static inline void st7305_stat_since(struct st7305 *st7305,
+				     enum st7305_stat stat, ktime_t start)
+{
+	st7305_stat(st7305, stat, ktime_to_ns(ktime_sub(ktime_get(), start)));
+}
+
+/* dbi->command with the emulate parameter, nothing goes out on the bus */
+static int st7305_emu_dbi_command(struct mipi_dbi *dbi, u8 *cmd, u8 *param,
+				  size_t num)
+{
+	st7305_emu_command(dbi_to_st7305(dbi)->emu, *cmd, param, num);
+	return 0;
+}
+
+static int st7305_emu_setup(struct st7305 *st7305)
+{
+	struct mipi_dbi *dbi = st7305->dbi;
+
+	st7305->emu = devm_kzalloc(st7305->dev, sizeof(*st7305->emu),
+				   GFP_KERNEL);
+	if (!st7305->emu)
+		return -ENOMEM;
+
+	/* without D/C memory writes fall back to synchronous commands */
+	dbi->command = st7305_emu_dbi_command;
+	dbi->dc = NULL;
+
+	dev_info(st7305->dev, "emulating the panel, the bus stays idle\n");
+
+	return st7305_emu_init(st7305->dev, st7305->emu, st7305->desc->panel);
+}
+
 /*
  * The device tree node may specify the wrong GPIO
  * active behavior, hard-coded as low active here
@@ -100,93 +272,356 @@ static irqreturn_t st7305_irq_handler(int irq, void *dev_id)
 {
 	struct st7305 *st7305 = (struct st7305 *)dev_id;
 
+	st7305->te_stamp = ktime_get();
+	st7305->te_count++;
+	trace_st7305_te(st7305->te_count);
+
+	if (smp_load_acquire(&st7305->te_measuring)) {
+		if (!st7305->te_first_stamp) {
+			st7305->te_first_stamp = st7305->te_stamp;
+			st7305->te_first = st7305->te_count;
+		} else if (st7305->te_count - st7305->te_first ==
+			   ST7305_TE_SAMPLES) {
+			mod_delayed_work(system_wq, &st7305->te_work, 0);
+		}
+	}
+
+	if (drm_dev_has_vblank(st7305->drm))
+		drm_crtc_handle_vblank(&st7305->dbidev->pipe.crtc);
+
 	complete(&st7305->refresh_done);
 	return IRQ_HANDLED;
 }
 
-static void st7305_pipe_enable(struct drm_simple_display_pipe *pipe,
-			       struct drm_crtc_state *crtc_state,
-			       struct drm_plane_state *plane_state)
+/*
+ * DRM_SIMPLE_MODE() only carries a placeholder clock. The first
+ * ST7305_TE_SAMPLES TE periods after an enable are timed from the IRQ
+ * handler, then the clock is derived from them, so the mode reports the
+ * real refresh rate and vblank timestamps use the right frame duration.
+ * Runs once they are in or after ST7305_TE_TIMEOUT_MS, whichever is first.
+ */
+static void st7305_te_worker(struct work_struct *work)
 {
-	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(pipe->crtc.dev);
-	struct mipi_dbi *dbi = &dbidev->dbi;
-	struct st7305 *st7305 = dbi_to_st7305(dbi);
-	const u8 *caset, *raset;
-	u8 addr_mode;
-	int idx;
+	struct st7305 *st7305 = container_of(work, struct st7305,
+					     te_work.work);
+	struct drm_crtc *crtc = &st7305->dbidev->pipe.crtc;
+	struct drm_display_mode *mode = &st7305->dbidev->mode;
+	struct drm_display_mode adjusted;
+	u32 edges;
+	s64 ns;
+
+	/* the handler is done with the timed edges after this */
+	WRITE_ONCE(st7305->te_measuring, false);
+	synchronize_irq(st7305->te_irq);
+
+	edges = st7305->te_count - st7305->te_first;
+	ns = ktime_to_ns(ktime_sub(st7305->te_stamp,
+				   st7305->te_first_stamp));
+	if (!st7305->te_first_stamp || edges < ST7305_TE_SAMPLES || ns <= 0) {
+		st7305->te_failed = true;
+		dev_warn(st7305->dev, "No TE from the panel\n");
+		return;
+	}
 
-	if (!drm_dev_enter(pipe->crtc.dev, &idx))
+	st7305->te_mhz = div64_u64((u64)edges * NSEC_PER_SEC * 1000, ns);
+	mode->clock = max_t(int, 1, DIV_ROUND_CLOSEST_ULL((u64)mode->htotal *
+				mode->vtotal * st7305->te_mhz, 1000000));
+
+	/* the pipe has the one fixed mode, no need for the CRTC state */
+	adjusted = *mode;
+	drm_mode_set_crtcinfo(&adjusted, 0);
+	drm_calc_timestamping_constants(crtc, &adjusted);
+
+	dev_info(st7305->dev, "TE at %u.%03u Hz\n", st7305->te_mhz / 1000,
+		 st7305->te_mhz % 1000);
+}
+
+/* Time the next TE edges, unless the rate is known or there is no TE */
+static void st7305_measure_te(struct st7305 *st7305)
+{
+	if (st7305->te_mhz || st7305->te_failed)
 		return;
 
-	caset = st7305->desc->caset;
-	raset = st7305->desc->raset;
+	st7305->te_first_stamp = 0;
+	smp_store_release(&st7305->te_measuring, true);
+	mod_delayed_work(system_wq, &st7305->te_work,
+			 msecs_to_jiffies(ST7305_TE_TIMEOUT_MS));
+}
 
-	st7305_reset(dbi);
+/* The pipe goes off, an unfinished measurement is retried next enable */
+static void st7305_measure_te_cancel(struct st7305 *st7305)
+{
+	WRITE_ONCE(st7305->te_measuring, false);
+	synchronize_irq(st7305->te_irq);
+	cancel_delayed_work_sync(&st7305->te_work);
+}
 
-	mipi_dbi_command(dbi, 0xD1, 0x01); // Booster Enable
-	mipi_dbi_command(dbi, 0xC0, 0x12, 0x0A); // Gate Voltage Setting
+static void st7305_send_event(struct st7305 *st7305,
+			      struct drm_pending_vblank_event *event)
+{
+	struct drm_device *drm = st7305->drm;
+	unsigned long flags;
 
-	mipi_dbi_command(dbi, 0xC1, 0x3C, 0x3E, 0x3C,
-			 0x3C); // VSHP Setting (4.8V)
-	mipi_dbi_command(dbi, 0xC2, 0x23, 0x21, 0x23,
-			 0x23); // VSLP Setting (0.98V)
-	mipi_dbi_command(dbi, 0xC4, 0x5A, 0x5C, 0x5A,
-			 0x5A); // VSHN Setting (-3.6V)
-	mipi_dbi_command(dbi, 0xC5, 0x37, 0x35, 0x37,
-			 0x37); // VSLN Setting (0.22V)
+	if (!event)
+		return;
 
-	mipi_dbi_command(dbi, 0xD8, 0x80, 0xE9);
+	spin_lock_irqsave(&drm->event_lock, flags);
+	drm_crtc_send_vblank_event(&st7305->dbidev->pipe.crtc, event);
+	spin_unlock_irqrestore(&drm->event_lock, flags);
+}
 
-	mipi_dbi_command(dbi, 0xB2, 0x02); // Frame Rate Control
+/*
+ * The power on sequence, split where st7305_panel_init() has to send the
+ * commands that depend on the device in between.
+ */
+static const u8 st7305_init_table[] = {
+	MIPI_DBI_CMD(0xD1, 0x01), // Booster Enable
+	MIPI_DBI_CMD(0xC0, 0x12, 0x0A), // Gate Voltage Setting
+
+	MIPI_DBI_CMD(0xC1, 0x3C, 0x3E, 0x3C, 0x3C), // VSHP Setting (4.8V)
+	MIPI_DBI_CMD(0xC2, 0x23, 0x21, 0x23, 0x23), // VSLP Setting (0.98V)
+	MIPI_DBI_CMD(0xC4, 0x5A, 0x5C, 0x5A, 0x5A), // VSHN Setting (-3.6V)
+	MIPI_DBI_CMD(0xC5, 0x37, 0x35, 0x37, 0x37), // VSLN Setting (0.22V)
+
+	MIPI_DBI_CMD(0xD8, 0x80, 0xE9),
+
+	MIPI_DBI_CMD(0xB2, 0x02), // Frame Rate Control
 
 	// Update Period Gate EQ Control in HPM
-	mipi_dbi_command(dbi, 0xB3, 0xE5, 0xF6, 0x17, 0x77, 0x77, 0x77, 0x77,
-			 0x77, 0x77, 0x71);
+	MIPI_DBI_CMD(0xB3, 0xE5, 0xF6, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77,
+		     0x77, 0x71),
 	// Update Period Gate EQ Control in LPM
-	mipi_dbi_command(dbi, 0xB4, 0x05, 0x46, 0x77, 0x77, 0x77, 0x77, 0x76,
-			 0x45);
-	mipi_dbi_command(dbi, 0x62, 0x32, 0x03, 0x1F); // Gate Timing Control
-
-	mipi_dbi_command(dbi, 0xB7, 0x13); // Source EQ Enable
-
-	mipi_dbi_command(dbi, MIPI_DCS_EXIT_SLEEP_MODE);
-	msleep(120);
-
-	mipi_dbi_command(dbi, 0xC9, 0x00); // Source Voltage Select
-
-	switch (dbidev->rotation) {
-	default:
-		addr_mode = ST7305_MADCTL_MX | ST7305_MADCTL_GS;
-		break;
-	case 90:
-	case 180:
-	case 270:
-		addr_mode = ST7305_MADCTL_MX | ST7305_MADCTL_GS;
-		printk("%s, Rotation is not supported yet.", __func__);
-		break;
+	MIPI_DBI_CMD(0xB4, 0x05, 0x46, 0x77, 0x77, 0x77, 0x77, 0x76, 0x45),
+	MIPI_DBI_CMD(0x62, 0x32, 0x03, 0x1F), // Gate Timing Control
+
+	MIPI_DBI_CMD(0xB7, 0x13), // Source EQ Enable
+
+	MIPI_DBI_CMD(MIPI_DCS_EXIT_SLEEP_MODE),
+	MIPI_DBI_DELAY(120),
+
+	MIPI_DBI_CMD(0xC9, 0x00), // Source Voltage Select
+	MIPI_DBI_END,
+};
+
+/* After the address mode */
+static const u8 st7305_panel_table[] = {
+	MIPI_DBI_CMD(MIPI_DCS_SET_PIXEL_FORMAT, 0x11), // 3 write for 24bit
+	MIPI_DBI_CMD(0xB9, 0x20), // Gamma Mode Setting
+	MIPI_DBI_CMD(0xB8, 0x29), // Panel Setting
+	MIPI_DBI_END,
+};
+
+/* After the window */
+static const u8 st7305_power_table[] = {
+	MIPI_DBI_CMD(0xD0, 0xFF), // Auto power down
+	MIPI_DBI_CMD(0x38), // High Power Mode on
+	MIPI_DBI_CMD(0xBB, 0x4F), // Enable Clear RAM
+	MIPI_DBI_END,
+};
+
+/* After TE */
+static const u8 st7305_display_on_table[] = {
+	MIPI_DBI_CMD(MIPI_DCS_ENTER_INVERT_MODE),
+	MIPI_DBI_CMD(MIPI_DCS_SET_DISPLAY_ON),
+	MIPI_DBI_END,
+};
+
+/* Charge the time since the last call to the current power mode */
+static void st7305_pm_account(struct st7305 *st7305, ktime_t now)
+{
+	s64 delta = ktime_us_delta(now, st7305->pm_since);
+
+	if (st7305->lpm)
+		st7305->lpm_us += delta;
+	else
+		st7305->hpm_us += delta;
+	st7305->pm_since = now;
+}
+
+static void st7305_set_lpm(struct st7305 *st7305, bool lpm)
+{
+	ktime_t start;
+	s64 lat;
+
+	lockdep_assert_held(&st7305->pm_lock);
+
+	if (!st7305->pm_active || st7305->lpm == lpm)
+		return;
+
+	/* the last run of a frame must not be cut short by the mode switch */
+	mipi_dbi_async_wait(st7305->dbi);
+
+	start = ktime_get();
+	mipi_dbi_command(st7305->dbi, lpm ? ST7305_LPM : ST7305_HPM);
+	lat = ktime_us_delta(ktime_get(), start);
+
+	st7305_pm_account(st7305, start);
+	st7305->lpm = lpm;
+	st7305->pm_transitions++;
+
+	if (lpm) {
+		st7305->lpm_enter_us = lat;
+		st7305->lpm_enter_max_us = max(st7305->lpm_enter_max_us, lat);
+	} else {
+		st7305->lpm_exit_us = lat;
+		st7305->lpm_exit_max_us = max(st7305->lpm_exit_max_us, lat);
+	}
+}
+
+/*
+ * Drop into Low Power Mode once nothing was flushed for idle_ms. The flush
+ * worker switches back to HPM before it touches the RAM and re-arms this.
+ */
+static void st7305_idle_worker(struct work_struct *work)
+{
+	struct st7305 *st7305 = container_of(to_delayed_work(work),
+					     struct st7305, idle_work);
+	unsigned int idle_ms = READ_ONCE(st7305->idle_ms);
+	unsigned long expires;
+	int idx;
+
+	if (!drm_dev_enter(st7305->drm, &idx))
+		return;
+
+	mutex_lock(&st7305->pm_lock);
+	expires = st7305->last_update + msecs_to_jiffies(idle_ms);
+	if (!idle_ms)
+		st7305_set_lpm(st7305, false);
+	else if (time_after_eq(jiffies, expires))
+		st7305_set_lpm(st7305, true);
+	else
+		mod_delayed_work(system_wq, &st7305->idle_work,
+				 expires - jiffies);
+	mutex_unlock(&st7305->pm_lock);
+
+	drm_dev_exit(idx);
+}
+
+/*
+ * Kick the flush worker, at most max_fps times a second. Commits arriving
+ * in between only pile up damage, which goes out with the next slot, so
+ * the last frame always lands. Periods are rounded up to whole jiffies.
+ */
+static void st7305_queue_flush(struct st7305 *st7305)
+{
+	unsigned int max_fps = READ_ONCE(st7305->max_fps);
+	unsigned long period, next, delay = 0;
+
+	if (max_fps) {
+		period = DIV_ROUND_UP(HZ, max_fps);
+		next = READ_ONCE(st7305->last_update) + period;
+		if (time_before(jiffies, next))
+			delay = min(next - jiffies, period);
 	}
-	mipi_dbi_command(dbi, MIPI_DCS_SET_ADDRESS_MODE, addr_mode);
-	mipi_dbi_command(dbi, MIPI_DCS_SET_PIXEL_FORMAT,
-			 0x11); // 3 write for 24bit
-	mipi_dbi_command(dbi, 0xB9, 0x20); // Gamma Mode Setting
-	mipi_dbi_command(dbi, 0xB8, 0x29); // Panel Setting
+
+	queue_delayed_work(system_highpri_wq, &st7305->flush_work, delay);
+}
+
+/* Full power on sequence, leaves the panel on in HPM with a cleared RAM */
+static void st7305_panel_init(struct st7305 *st7305)
+{
+	struct mipi_dbi *dbi = st7305->dbi;
+	const u8 *caset = st7305->desc->panel->caset;
+	const u8 *raset = st7305->desc->panel->raset;
+
+	st7305_reset(dbi);
+
+	mipi_dbi_command_table(dbi, st7305_init_table);
+
+	/* rotation is applied while converting, see st7305_fb_to_mono() */
+	mipi_dbi_command(dbi, MIPI_DCS_SET_ADDRESS_MODE,
+			 ST7305_MADCTL_MX | ST7305_MADCTL_GS);
+	mipi_dbi_command_table(dbi, st7305_panel_table);
 
 	mipi_dbi_command(dbi, MIPI_DCS_SET_COLUMN_ADDRESS, caset[0], caset[1]);
 	mipi_dbi_command(dbi, MIPI_DCS_SET_PAGE_ADDRESS, raset[0], raset[1]);
 
-	mipi_dbi_command(dbi, 0xD0, 0xFF); // Auto power down
-	mipi_dbi_command(dbi, 0x38); // High Power Mode on
-	mipi_dbi_command(dbi, 0xBB, 0x4F); // Enable Clear RAM
+	mipi_dbi_command_table(dbi, st7305_power_table);
 
 	if (st7305->te)
 		mipi_dbi_command(dbi, 0x35, 0x00); // 0b00: TE v-blanking mode
 	else
 		mipi_dbi_command(dbi, 0x34); // TE off
 
-	mipi_dbi_command(dbi, MIPI_DCS_ENTER_INVERT_MODE);
-	mipi_dbi_command(dbi, MIPI_DCS_SET_DISPLAY_ON);
+	mipi_dbi_command_table(dbi, st7305_display_on_table);
+	mipi_dbi_command_table(dbi, st7305->desc->init_table);
+}
+
+static void st7305_pipe_enable(struct drm_simple_display_pipe *pipe,
+			       struct drm_crtc_state *crtc_state,
+			       struct drm_plane_state *plane_state)
+{
+	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(pipe->crtc.dev);
+	struct mipi_dbi *dbi = &dbidev->dbi;
+	struct st7305 *st7305 = dbi_to_st7305(dbi);
+	ktime_t start = ktime_get();
+	bool fast;
+	int idx;
+	int ret;
 
-	st7305->desc->init_seq(st7305);
+	/* wakes a sleeping panel, balanced by st7305_pipe_disable() */
+	ret = pm_runtime_get_sync(st7305->dev);
+	if (ret < 0)
+		dev_err(st7305->dev, "Failed to resume %d\n", ret);
+
+	if (!drm_dev_enter(pipe->crtc.dev, &idx))
+		return;
+
+	/*
+	 * Plane updates are committed before the CRTC is enabled, don't let
+	 * the worker talk to the panel while it is being initialized.
+	 */
+	cancel_delayed_work_sync(&st7305->flush_work);
+	cancel_delayed_work_sync(&st7305->idle_work);
+	mipi_dbi_async_wait(dbi);
+
+	st7305->resume_start = start;
+	spin_lock_irq(&st7305->stats_lock);
+	st7305->resume_bytes = 0;
+	spin_unlock_irq(&st7305->stats_lock);
+	WRITE_ONCE(st7305->resuming, true);
+
+	/*
+	 * Display off and sleep-in keep the RAM and all settings, the panel
+	 * only has to be switched back on. Whatever changed meanwhile goes out
+	 * as damage against the shadow.
+	 */
+	mutex_lock(&st7305->pm_lock);
+	fast = st7305->panel_ready;
+	mutex_unlock(&st7305->pm_lock);
+
+	if (fast)
+		mipi_dbi_command(dbi, MIPI_DCS_SET_DISPLAY_ON);
+	else
+		st7305_panel_init(st7305);
+
+	/* sleep keeps the power mode */
+	mutex_lock(&st7305->pm_lock);
+	if (fast) {
+		st7305->resume_fast++;
+	} else {
+		st7305->resume_cold++;
+		st7305->panel_ready = true;
+		st7305->asleep = false;
+		st7305->sleep_out = ktime_get();
+		st7305->lpm = false;
+	}
+	st7305->pm_active = true;
+	st7305->pm_since = ktime_get();
+	mutex_unlock(&st7305->pm_lock);
+
+	if (st7305->te) {
+		drm_crtc_vblank_on(&pipe->crtc);
+		st7305_measure_te(st7305);
+	}
+
+	/* RAM was cleared, resend the whole frame held in tx_buf */
+	if (!fast) {
+		mutex_lock(&st7305->buf_lock);
+		st7305_flush_all(&st7305->flush);
+		mutex_unlock(&st7305->buf_lock);
+	}
+	mod_delayed_work(system_highpri_wq, &st7305->flush_work, 0);
 
 	drm_dev_exit(idx);
 }
@@ -195,148 +630,375 @@ static void st7305_pipe_disable(struct drm_simple_display_pipe *pipe)
 {
 	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(pipe->crtc.dev);
 	struct mipi_dbi *dbi = &dbidev->dbi;
+	struct st7305 *st7305 = dbi_to_st7305(dbi);
 
 	DRM_DEBUG_KMS("\n");
 
-	mipi_dbi_command(dbi, MIPI_DCS_SET_DISPLAY_OFF);
-}
+	/* let the last frame land before turning the display off */
+	flush_delayed_work(&st7305->flush_work);
+	cancel_delayed_work_sync(&st7305->idle_work);
 
-static inline void st7305_draw_pixel(u8 *dst, uint x, uint y, u8 left_offset,
-				     u8 page_size, u8 gray)
-{
-	uint new_x = x + left_offset;
-	u32 byte_idx = ((y >> 1) * page_size) + (new_x >> 2);
-	u32 bit_idx = ((new_x & 3) << 1) | (y & 1);
-	u8 mask = BIT(7 - bit_idx);
-	u8 set = (gray >> 7) * mask;
+	if (st7305->te) {
+		st7305_measure_te_cancel(st7305);
+		drm_crtc_vblank_off(&pipe->crtc);
+	}
+
+	mutex_lock(&st7305->pm_lock);
+	if (st7305->pm_active)
+		st7305_pm_account(st7305, ktime_get());
+	st7305->pm_active = false;
+	mutex_unlock(&st7305->pm_lock);
 
-	dst[byte_idx] = (dst[byte_idx] & ~mask) | set;
+	mipi_dbi_command(dbi, MIPI_DCS_SET_DISPLAY_OFF);
+
+	pm_runtime_mark_last_busy(st7305->dev);
+	pm_runtime_put_autosuspend(st7305->dev);
 }
 
-static inline void st7306_draw_pixel(u8 *dst, uint x, uint y, u8 left_offset,
-				     u8 page_size, u8 gray)
+/*
+ * Runs once the display was off for the autosuspend delay. Sleep-in stops
+ * the booster and the scan but keeps the RAM and the settings, so that
+ * st7305_pipe_enable() only needs a sleep-out and a display on to bring the
+ * last frame back: no reset, no init tables, no clear and no repaint.
+ * A failed sleep-in is returned, which keeps the device active.
+ */
+static int st7305_runtime_suspend(struct device *dev)
 {
-	uint new_x = x + left_offset;
+	struct st7305 *st7305 = dev_get_drvdata(dev);
+	int ret = 0;
+	int idx;
+	s64 ms;
 
-	uint real_x = new_x >> 1;
-	uint real_y = y >> 1;
-	uint byte_idx = real_y * page_size + real_x;
+	/* an unplugged panel is not talked to anymore */
+	if (!drm_dev_enter(st7305->drm, &idx))
+		return 0;
 
-	uint y_bit = y & 1;
-	uint x_bit = new_x & 1;
+	mutex_lock(&st7305->pm_lock);
+	if (st7305->panel_ready && !st7305->asleep) {
+		ms = ST7305_SLPOUT_SLPIN_MS -
+		     ktime_ms_delta(ktime_get(), st7305->sleep_out);
+		if (ms > 0)
+			msleep(ms);
 
-	uint base_bit = (x_bit << 2) + y_bit;
-	u8 mask = BIT(7 - base_bit) | BIT(5 - base_bit);
+		ret = mipi_dbi_command(st7305->dbi, MIPI_DCS_ENTER_SLEEP_MODE);
+		if (ret)
+			dev_err(dev, "Failed to enter sleep mode %d\n", ret);
+		else
+			st7305->asleep = true;
+	}
+	mutex_unlock(&st7305->pm_lock);
 
-	u8 val = dst[byte_idx];
-	u8 on = -(gray >> 7); // (gray>>7)=0|1 -> 0x00|0xFF
+	drm_dev_exit(idx);
 
-	dst[byte_idx] = (val & ~mask) | (on & mask);
+	return ret;
 }
 
-static void st7305_xrgb8888_to_mono(u8 *dst, void *vaddr,
-				    struct drm_framebuffer *fb,
-				    struct drm_rect *clip)
+static int st7305_runtime_resume(struct device *dev)
 {
-	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(fb->dev);
-	size_t len = (clip->x2 - clip->x1) * (clip->y2 - clip->y1);
-	void (*draw_pixel)(u8 *dst, uint x, uint y, u8 left_offset,
-			   u8 page_size, u8 gray);
-	struct st7305 *st7305 = dbidev_to_st7305(dbidev);
-	u8 *src, *buf, *dither_buf;
-	u8 offset, page_size;
-	unsigned int x, y;
-
-	buf = kmalloc(len, GFP_KERNEL);
-	if (!buf)
-		return;
-
-	drm_fb_xrgb8888_to_gray8(buf, vaddr, fb, clip);
-	src = buf;
-
-	if (st7305->dither_type > 0) {
-		dither_buf = kzalloc(fb->width * fb->height, GFP_KERNEL);
-		if (!dither_buf)
-			goto free_buf;
+	struct st7305 *st7305 = dev_get_drvdata(dev);
+	int ret = 0;
+	int idx;
 
-		dither_gray8_to_bw(st7305->dither_type, buf, dither_buf,
-				   fb->width, fb->height);
-		src = dither_buf;
+	if (!drm_dev_enter(st7305->drm, &idx))
+		return 0;
+
+	mutex_lock(&st7305->pm_lock);
+	if (st7305->asleep) {
+		ret = mipi_dbi_command(st7305->dbi, MIPI_DCS_EXIT_SLEEP_MODE);
+		if (ret) {
+			dev_err(dev, "Failed to exit sleep mode %d\n", ret);
+		} else {
+			st7305->sleep_out = ktime_get();
+			st7305->asleep = false;
+			msleep(ST7305_SLPOUT_CMD_MS);
+		}
 	}
+	mutex_unlock(&st7305->pm_lock);
 
-	offset = st7305->desc->left_offset;
-	page_size = st7305->desc->page_size;
-	draw_pixel = st7305->desc->draw_pixel;
-
-	for (y = clip->y1; y < clip->y2; y++)
-		for (x = clip->x1; x < clip->x2; x++)
-			draw_pixel(dst, x, y, offset, page_size, *src++);
+	drm_dev_exit(idx);
 
-	if (st7305->dither_type > 0) {
-		kfree(dither_buf);
-	}
+	return ret;
+}
 
-free_buf:
-	kfree(buf);
+#ifdef CONFIG_KERNEL_MODE_NEON
+static bool st7305_use_neon(void)
+{
+	return use_neon && cpu_has_neon();
+}
+#else
+static bool st7305_use_neon(void)
+{
+	return false;
 }
+#endif
 
 static int st7305_buf_copy(void *dst, struct drm_framebuffer *fb,
 			   struct drm_rect *clip)
 {
-	struct drm_gem_cma_object *cma_obj = drm_fb_cma_get_gem_obj(fb, 0);
-	struct dma_buf_attachment *import_attach = cma_obj->base.import_attach;
-	void *src = cma_obj->vaddr;
+	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(fb->dev);
+	struct drm_gem_object *obj = drm_gem_fb_get_obj(fb, 0);
+	struct dma_buf_attachment *import_attach = obj->import_attach;
+	struct st7305 *st7305 = dbidev_to_st7305(dbidev);
+	struct st7305_src src = {
+		.format = fb->format->format,
+		.pitch = fb->pitches[0],
+		.rotation = dbidev->rotation,
+		// CMA and most imports are write-combined
+		.bounce = !gem_shmem || import_attach,
+	};
+	u64 convert_ns = 0, pack_ns = 0;
 	int ret = 0;
 
+	if (gem_shmem) {
+		// only takes a reference, prepare_fb did the mapping
+		src.vaddr = drm_gem_shmem_vmap(obj);
+		if (IS_ERR(src.vaddr))
+			return PTR_ERR(src.vaddr);
+	} else {
+		src.vaddr = to_drm_gem_cma_obj(obj)->vaddr;
+	}
+
 	if (import_attach) {
 		ret = dma_buf_begin_cpu_access(import_attach->dmabuf,
 					       DMA_FROM_DEVICE);
 		if (ret)
-			return ret;
+			goto out_vunmap;
 	}
 
-	st7305_xrgb8888_to_mono(dst, src, fb, clip);
+	trace_st7305_convert_begin(fb->base.id, clip, st7305->dither_type);
+	st7305_fb_to_mono(&st7305->conv, dst, &src, clip, st7305->dither_type,
+			  st7305_use_neon(), &convert_ns, &pack_ns);
+	trace_st7305_convert_end(fb->base.id, clip, st7305->dither_type);
+	st7305_stat(st7305, ST7305_STAT_CONVERT, convert_ns);
+	st7305_stat(st7305, ST7305_STAT_PACK, pack_ns);
 
 	if (import_attach)
 		ret = dma_buf_end_cpu_access(import_attach->dmabuf,
 					     DMA_FROM_DEVICE);
 
+out_vunmap:
+	if (gem_shmem)
+		drm_gem_shmem_vunmap(obj, src.vaddr);
+
 	return ret;
 }
 
-static void st7305_fb_dirty(struct drm_framebuffer *fb, struct drm_rect *rect)
+/*
+ * The first frame after an enable is on the panel, or there was nothing to
+ * send. Also called from the SPI completion context.
+ */
+static void st7305_resume_done(struct st7305 *st7305)
 {
-	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(fb->dev);
-	struct mipi_dbi *dbi = &dbidev->dbi;
-	struct st7305 *st7305 = dbi_to_st7305(&dbidev->dbi);
-	size_t bufsize;
+	if (!xchg(&st7305->resuming, false))
+		return;
+
+	st7305->resume_us = ktime_us_delta(ktime_get(), st7305->resume_start);
+}
+
+/* Called from the SPI completion context once a run went out */
+static void st7305_flush_done(struct mipi_dbi_async *async)
+{
+	struct st7305 *st7305 = container_of(async, struct st7305, flush_async);
+
+	if (async->status)
+		WRITE_ONCE(st7305->flush_error, async->status);
+	else
+		st7305_count(st7305, &st7305->bytes_sent, async->len);
+	/* counted before st7305_resume_done() below ends the resume */
+	if (!async->status && READ_ONCE(st7305->resuming))
+		st7305_count(st7305, &st7305->resume_bytes, async->len);
+
+	if (st7305->spi_start) {
+		st7305_stat(st7305, ST7305_STAT_SPI, st7305->spi_ns +
+			    ktime_to_ns(ktime_sub(ktime_get(),
+						  st7305->spi_start)));
+		st7305->spi_start = 0;
+		st7305_resume_done(st7305);
+	}
+
+	st7305_send_event(st7305, xchg(&st7305->flush_event, NULL));
+}
+
+static void st7305_flush_failed(struct st7305 *st7305, int ret)
+{
+	mutex_lock(&st7305->buf_lock);
+	st7305->flush.shadow_valid = false;
+	mutex_unlock(&st7305->buf_lock);
+	dev_err_once(st7305->dev, "Failed to update display %d\n", ret);
+}
+
+/*
+ * Convert the damage collected since the last flush into tx_buf and add its
+ * RAM windows to the pending ones. Called with buf_lock held.
+ */
+static void st7305_fb_dirty(struct st7305 *st7305, struct drm_framebuffer *fb)
+{
+	struct drm_rect *rect, win;
+	ktime_t start;
 	int ret = 0;
-	int idx;
+	int i;
 
-	if (!drm_dev_enter(fb->dev, &idx))
-		return;
+	start = ktime_get();
+	for (i = 0; i < st7305->flush.damage_nr && !ret; i++) {
+		rect = &st7305->flush.damage[i];
+
+		DRM_DEBUG_KMS("Flushing [FB:%d] " DRM_RECT_FMT "\n",
+			      fb->base.id, DRM_RECT_ARG(rect));
+
+		st7305_damage_to_window(&st7305->flush, rect, &win);
+		st7305_stat(st7305, ST7305_STAT_DAMAGE,
+			    drm_rect_width(rect) * drm_rect_height(rect));
 
-	DRM_DEBUG_KMS("Flushing [FB:%d] " DRM_RECT_FMT "\n", fb->base.id,
-		      DRM_RECT_ARG(rect));
+		ret = st7305_buf_copy(st7305->dbidev->tx_buf, fb, rect);
+		if (!ret)
+			st7305_add_window(&st7305->flush, &win);
+	}
+	st7305_stat_since(st7305, ST7305_STAT_COPY, start);
+	st7305->flush.damage_nr = 0;
 
-	bufsize = st7305->desc->bufsize;
+	if (ret)
+		dev_err_once(st7305->dev, "Failed to update display %d\n",
+			     ret);
+}
+
+static void st7305_flush_worker(struct work_struct *work)
+{
+	struct st7305 *st7305 = container_of(work, struct st7305,
+					     flush_work.work);
+	const struct st7305_panel *panel = st7305->desc->panel;
+	struct st7305_run runs[ST7305_MAX_RUNS];
+	struct drm_pending_vblank_event *event;
+	struct drm_framebuffer *fb;
+	struct mipi_dbi *dbi = st7305->dbi;
+	u64 cmd_ns = 0, spi_ns = 0;
+	ktime_t start, run = 0;
+	unsigned int idle_ms;
+	int i, nr, idx, ret;
+	size_t width, len, skipped = 0;
+	u8 *tr;
+
+	if (!drm_dev_enter(st7305->drm, &idx)) {
+		/* nothing reaches the panel any more, don't strand the flip */
+		mutex_lock(&st7305->buf_lock);
+		event = st7305->event;
+		st7305->event = NULL;
+		mutex_unlock(&st7305->buf_lock);
+		st7305_send_event(st7305, event);
+		return;
+	}
 
-	ret = st7305_buf_copy(dbidev->tx_buf, fb, rect);
+	/* tx_buf is free while the previous frame is still on the bus */
+	mutex_lock(&st7305->buf_lock);
+	fb = st7305->damage_fb;
+	st7305->damage_fb = NULL;
+	if (fb)
+		st7305_fb_dirty(st7305, fb);
+	mutex_unlock(&st7305->buf_lock);
+	if (fb)
+		drm_framebuffer_put(fb);
+
+	/* win_buf is about to be rewritten, the previous frame must be out */
+	if (mipi_dbi_async_wait(dbi) == -ETIMEDOUT) {
+		/* still on the bus, keep the windows for the next flush */
+		st7305_flush_failed(st7305, -ETIMEDOUT);
+		mutex_lock(&st7305->buf_lock);
+		event = st7305->event;
+		st7305->event = NULL;
+		mutex_unlock(&st7305->buf_lock);
+		goto out_event;
+	}
+	ret = xchg(&st7305->flush_error, 0);
 	if (ret)
-		goto err_msg;
+		st7305_flush_failed(st7305, ret);
+
+	mutex_lock(&st7305->buf_lock);
+	nr = st7305_flush_runs(&st7305->flush, st7305->dbidev->tx_buf, runs,
+			       st7305->win_buf, &skipped);
+	event = st7305->event;
+	st7305->event = NULL;
+	mutex_unlock(&st7305->buf_lock);
+	st7305_count(st7305, &st7305->bytes_skipped, skipped);
+
+	if (!nr) {
+		st7305_resume_done(st7305);
+		goto out_event;
+	}
+
+	mutex_lock(&st7305->pm_lock);
+	WRITE_ONCE(st7305->last_update, jiffies);
+	st7305_set_lpm(st7305, false);
+	mutex_unlock(&st7305->pm_lock);
 
 	if (st7305->te) {
+		/* an edge from before now is stale, wait for the next one */
+		start = ktime_get();
+		reinit_completion(&st7305->refresh_done);
 		wait_for_completion_timeout(&st7305->refresh_done,
 					    msecs_to_jiffies(50));
-		reinit_completion(&st7305->refresh_done);
+		st7305_stat_since(st7305, ST7305_STAT_TE_WAIT, start);
 	}
 
-	ret = mipi_dbi_command_buf(dbi, MIPI_DCS_WRITE_MEMORY_START,
-				   (u8 *)dbidev->tx_buf, bufsize);
-err_msg:
-	if (ret)
-		dev_err_once(fb->dev->dev, "Failed to update display %d\n",
-			     ret);
+	tr = st7305->win_buf;
+	for (i = 0; i < nr; i++) {
+		width = (runs[i].x2 - runs[i].x1) * ST7305_COL_BYTES;
+		len = width * (runs[i].last - runs[i].first + 1);
+
+		/* the previous run has to leave the bus before the next window */
+		if (i) {
+			mipi_dbi_async_wait(dbi);
+			spi_ns += ktime_to_ns(ktime_sub(ktime_get(), run));
+		}
+
+		start = ktime_get();
+		if (!i || runs[i].x1 != runs[i - 1].x1 ||
+		    runs[i].x2 != runs[i - 1].x2)
+			mipi_dbi_command(dbi, MIPI_DCS_SET_COLUMN_ADDRESS,
+					 panel->caset[0] + runs[i].x1,
+					 panel->caset[0] + runs[i].x2 - 1);
+		mipi_dbi_command(dbi, MIPI_DCS_SET_PAGE_ADDRESS,
+				 panel->raset[0] + runs[i].first,
+				 panel->raset[0] + runs[i].last);
+		run = ktime_get();
+		cmd_ns += ktime_to_ns(ktime_sub(run, start));
+
+		/* the page flip completes when the last run has landed */
+		if (i == nr - 1) {
+			st7305->flush_event = event;
+			event = NULL;
+			st7305->spi_ns = spi_ns;
+			st7305->spi_start = run;
+		}
+
+		ret = mipi_dbi_command_buf_async(dbi,
+						 MIPI_DCS_WRITE_MEMORY_START,
+						 tr, len, &st7305->flush_async);
+		if (ret) {
+			st7305_flush_failed(st7305, ret);
+			/* only the last run took the event over */
+			if (i == nr - 1) {
+				event = xchg(&st7305->flush_event, NULL);
+				st7305->spi_start = 0;
+			}
+			break;
+		}
+
+		tr += len;
+	}
+
+	/* emu_state reports the whole flush as one frame */
+	if (st7305->emu)
+		st7305_emu_frame_end(st7305->emu);
+
+	st7305_stat(st7305, ST7305_STAT_CMD, cmd_ns);
+	st7305_stat(st7305, ST7305_STAT_BYTES, tr - st7305->win_buf);
+
+	idle_ms = READ_ONCE(st7305->idle_ms);
+	if (idle_ms)
+		mod_delayed_work(system_wq, &st7305->idle_work,
+				 msecs_to_jiffies(idle_ms));
+
+out_event:
+	st7305_send_event(st7305, event);
 
 	drm_dev_exit(idx);
 }
@@ -347,33 +1009,131 @@ static void st7305_pipe_update(struct drm_simple_display_pipe *pipe,
 	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(pipe->crtc.dev);
 	struct st7305 *st7305 = dbidev_to_st7305(dbidev);
 	struct drm_plane_state *state = pipe->plane.state;
+	struct drm_rect rects[ST7305_MAX_DAMAGE], clip, damage;
+	struct drm_atomic_helper_damage_iter iter;
+	struct drm_pending_vblank_event *event;
 	struct drm_framebuffer *fb = state->fb;
-	struct drm_rect rect;
+	struct drm_framebuffer *old_fb = NULL;
+	bool full = false, kick;
+	int i, nr = 0;
 
-	if (!pipe->crtc.state->active)
+	event = pipe->crtc.state->event;
+	pipe->crtc.state->event = NULL;
+
+	if (!pipe->crtc.state->active) {
+		st7305_send_event(st7305, event);
 		return;
+	}
 
-	if (st7305->dither_type > 0) {
-		rect.x1 = 0;
-		rect.y1 = 0;
-		rect.x2 = fb->width;
-		rect.y2 = fb->height;
-		st7305_fb_dirty(fb, &rect);
+	/*
+	 * Ordered dithers are anchored to absolute coordinates and keep damage
+	 * tracking, error diffusion and a new dither type need the full frame.
+	 */
+	if (dither_is_diffusion(st7305->dither_type) ||
+	    xchg(&st7305->redraw, false)) {
+		rects[0].x1 = 0;
+		rects[0].y1 = 0;
+		rects[0].x2 = fb->width;
+		rects[0].y2 = fb->height;
+		nr = 1;
+		full = true;
 	} else {
-		if (drm_atomic_helper_damage_merged(old_state, state, &rect))
-			st7305_fb_dirty(fb, &rect);
+		/* each clip goes out as its own window unless merging pays */
+		drm_atomic_helper_damage_iter_init(&iter, old_state, state);
+		drm_atomic_for_each_plane_damage(&iter, &clip) {
+			if (nr < ST7305_MAX_DAMAGE)
+				rects[nr++] = clip;
+			else
+				st7305_rect_union(&rects[nr - 1], &clip);
+		}
+	}
+
+	kick = nr || event;
+	if (nr)
+		damage = rects[0];
+	for (i = 1; i < nr; i++)
+		st7305_rect_union(&damage, &rects[i]);
+	trace_st7305_update_begin(fb->base.id, nr ? &damage : NULL,
+				  st7305->dither_type);
+
+	/*
+	 * The worker converts the damage piled up since its last run from the
+	 * newest framebuffer and sends the event once the frame is on the
+	 * panel. An event still waiting there belongs to a frame superseded by
+	 * this one.
+	 */
+	mutex_lock(&st7305->buf_lock);
+	if (nr) {
+		old_fb = st7305->damage_fb;
+		st7305->damage_fb = fb;
+		drm_framebuffer_get(fb);
+		if (st7305->flush.damage_nr)
+			st7305_count(st7305, &st7305->frames_coalesced, 1);
+		/* error diffusion has to run over the frame exactly once */
+		if (full)
+			st7305->flush.damage_nr = 0;
+		for (i = 0; i < nr; i++)
+			st7305_add_damage(&st7305->flush, &rects[i]);
 	}
+	if (event)
+		swap(st7305->event, event);
+	mutex_unlock(&st7305->buf_lock);
+
+	if (old_fb)
+		drm_framebuffer_put(old_fb);
+	st7305_send_event(st7305, event);
+	if (kick)
+		st7305_queue_flush(st7305);
+
+	trace_st7305_update_end(fb->base.id, nr ? &damage : NULL,
+				st7305->dither_type);
 }
 
 static const u32 st7305_formats[] = {
 	DRM_FORMAT_XRGB8888,
+	DRM_FORMAT_R8,
+#ifdef DRM_FORMAT_R1
+	DRM_FORMAT_R1, // only defined by kernels that support 1bpp
+#endif
 };
 
+/*
+ * shmem objects are mapped on demand, keep the framebuffer mapped while it
+ * is on the plane so that the flush worker does not vmap every page again.
+ */
+static int st7305_pipe_prepare_fb(struct drm_simple_display_pipe *pipe,
+				  struct drm_plane_state *plane_state)
+{
+	void *vaddr;
+	int ret;
+
+	ret = drm_gem_fb_simple_display_pipe_prepare_fb(pipe, plane_state);
+	if (ret || !gem_shmem || !plane_state->fb)
+		return ret;
+
+	vaddr = drm_gem_shmem_vmap(drm_gem_fb_get_obj(plane_state->fb, 0));
+
+	return PTR_ERR_OR_ZERO(vaddr);
+}
+
+static void st7305_pipe_cleanup_fb(struct drm_simple_display_pipe *pipe,
+				   struct drm_plane_state *plane_state)
+{
+	struct drm_gem_object *obj;
+
+	if (!gem_shmem || !plane_state->fb)
+		return;
+
+	obj = drm_gem_fb_get_obj(plane_state->fb, 0);
+	drm_gem_shmem_vunmap(obj, to_drm_gem_shmem_obj(obj)->vaddr);
+}
+
 static const struct drm_simple_display_pipe_funcs st7305_pipe_funcs = {
 	.enable = st7305_pipe_enable,
 	.disable = st7305_pipe_disable,
 	.update = st7305_pipe_update,
-	.prepare_fb = drm_gem_fb_simple_display_pipe_prepare_fb,
+	.prepare_fb = st7305_pipe_prepare_fb,
+	.cleanup_fb = st7305_pipe_cleanup_fb,
 };
 
 static ssize_t dither_type_show(struct device *dev,
@@ -399,6 +1159,7 @@ static ssize_t dither_type_store(struct device *dev,
 		return -EINVAL;
 
 	st7305->dither_type = val;
+	WRITE_ONCE(st7305->redraw, true);
 
 	dev_info(dev, "set dither type to <%s>\n",
 		 dither_get_name(st7305->dither_type));
@@ -408,8 +1169,63 @@ static ssize_t dither_type_store(struct device *dev,
 
 static DEVICE_ATTR_RW(dither_type);
 
+static ssize_t idle_ms_show(struct device *dev, struct device_attribute *attr,
+			    char *buf)
+{
+	struct st7305 *st7305 = dev_get_drvdata(dev);
+	return scnprintf(buf, PAGE_SIZE, "%u\n", READ_ONCE(st7305->idle_ms));
+}
+
+static ssize_t idle_ms_store(struct device *dev, struct device_attribute *attr,
+			     const char *buf, size_t count)
+{
+	struct st7305 *st7305 = dev_get_drvdata(dev);
+	unsigned int val;
+	int ret;
+
+	ret = kstrtouint(buf, 10, &val);
+	if (ret)
+		return ret;
+
+	WRITE_ONCE(st7305->idle_ms, val);
+
+	/* re-evaluate now, 0 brings the panel back to HPM */
+	mod_delayed_work(system_wq, &st7305->idle_work, 0);
+
+	return count;
+}
+
+static DEVICE_ATTR_RW(idle_ms);
+
+static ssize_t max_fps_show(struct device *dev, struct device_attribute *attr,
+			    char *buf)
+{
+	struct st7305 *st7305 = dev_get_drvdata(dev);
+	return scnprintf(buf, PAGE_SIZE, "%u\n", READ_ONCE(st7305->max_fps));
+}
+
+static ssize_t max_fps_store(struct device *dev, struct device_attribute *attr,
+			     const char *buf, size_t count)
+{
+	struct st7305 *st7305 = dev_get_drvdata(dev);
+	unsigned int val;
+	int ret;
+
+	ret = kstrtouint(buf, 10, &val);
+	if (ret)
+		return ret;
+
+	WRITE_ONCE(st7305->max_fps, val);
+
+	return count;
+}
+
+static DEVICE_ATTR_RW(max_fps);
+
 static struct attribute *st7305_attrs[] = {
 	&dev_attr_dither_type.attr,
+	&dev_attr_idle_ms.attr,
+	&dev_attr_max_fps.attr,
 	NULL,
 };
 
@@ -418,224 +1234,415 @@ static const struct attribute_group st7305_attr_group = {
 	.attrs = st7305_attrs
 };
 
-static int ydp154h008_v3_init_seq(struct st7305 *st7305)
-{
-	struct mipi_dbi *dbi = st7305->dbi;
-
-	mipi_dbi_command(dbi, 0xD6, 0x17, 0x02); // NVM Load Control
+static const u8 ydp154h008_v3_init_table[] = {
+	MIPI_DBI_CMD(0xD6, 0x17, 0x02), // NVM Load Control
 	// Gate Voltage Setting, VGH: 12V, VGL: -6V
-	mipi_dbi_command(dbi, 0xC0, 0x08, 0x02);
+	MIPI_DBI_CMD(0xC0, 0x08, 0x02),
 	// VSHP Setting (4.8V)
-	mipi_dbi_command(dbi, 0xC1, 0X19, 0X19, 0X19, 0X19);
+	MIPI_DBI_CMD(0xC1, 0X19, 0X19, 0X19, 0X19),
 	// VSLP Setting (0.98V)
-	mipi_dbi_command(dbi, 0xC2, 0X31, 0X31, 0X31, 0X31);
+	MIPI_DBI_CMD(0xC2, 0X31, 0X31, 0X31, 0X31),
 	// VSHN Setting (-3.6V)
-	mipi_dbi_command(dbi, 0xC4, 0X19, 0X19, 0X19, 0X19);
+	MIPI_DBI_CMD(0xC4, 0X19, 0X19, 0X19, 0X19),
 	// VSLN Setting (0.22V)
-	mipi_dbi_command(dbi, 0xC5, 0X27, 0X27, 0X27, 0X27);
-	// mipi_dbi_command(dbi, 0xB3, 0xE5, 0xF6, 0x05, 0x46, 0x77, 0x77, 0x77,
-	// 		 0x77, 0x76, 0x45);
-	mipi_dbi_command(dbi, 0xB0, 0x32); // Gate Line Setting: 200 line
-
-	return 0;
-}
-
-static const struct drm_display_mode ydp154h008_v3_mode = {
-	DRM_SIMPLE_MODE(200, 200, 28, 28),
+	MIPI_DBI_CMD(0xC5, 0X27, 0X27, 0X27, 0X27),
+	// MIPI_DBI_CMD(0xB3, 0xE5, 0xF6, 0x05, 0x46, 0x77, 0x77, 0x77,
+	// 	     0x77, 0x76, 0x45),
+	MIPI_DBI_CMD(0xB0, 0x32), // Gate Line Setting: 200 line
+	MIPI_DBI_END,
 };
 
 static const struct st7305_panel_desc ydp154h008_v3_desc = {
-	.mode = &ydp154h008_v3_mode,
-
-	.caset[0] = 0x16,
-	.caset[1] = 0x26,
-
-	.raset[0] = 0x00,
-	.raset[1] = 0x63,
-
-	.left_offset = 4,
-
-	.page_size = 51, // 200/8*2=50≈51 (3 bytes per write)
-	.page_count = 100, // 200/2=100
+	.panel = &ydp154h008_v3_panel,
+	.init_table = ydp154h008_v3_init_table,
+};
 
-	.bufsize = 51 * 100,
+static const u8 ydp213h001_v3_init_table[] = {
+	MIPI_DBI_CMD(0xD6, 0x17, 0x02), // NVM Load Control
+	MIPI_DBI_CMD(0xC0, 0x0E, 0x05), // Gate Voltage Setting
+	// MIPI_DBI_CMD(0xB2, 0x15), // Frame Rate Control
 
-	.init_seq = ydp154h008_v3_init_seq,
-	.draw_pixel = st7305_draw_pixel,
+	MIPI_DBI_CMD(0xB0, 0x3F), // Gate Line Setting: 252 line
+	MIPI_DBI_END,
 };
 
-static int ydp213h001_v3_init_seq(struct st7305 *st7305)
-{
-	struct mipi_dbi *dbi = st7305->dbi;
+static const struct st7305_panel_desc ydp213h001_v3_desc = {
+	.panel = &ydp213h001_v3_panel,
+	.init_table = ydp213h001_v3_init_table,
+};
 
-	mipi_dbi_command(dbi, 0xD6, 0x17, 0x02); // NVM Load Control
-	mipi_dbi_command(dbi, 0xC0, 0x0E, 0x05); // Gate Voltage Setting
-	// mipi_dbi_command(dbi, 0xB2, 0x15); // Frame Rate Control
+static const u8 ydp290h001_v3_init_table[] = {
+	MIPI_DBI_CMD(0xD6, 0x17, 0x02), // NVM Load Control
 
-	mipi_dbi_command(dbi, 0xB0, 0x3F); // Gate Line Setting: 252 line
+	MIPI_DBI_CMD(0xD8, 0xA6, 0xE9),
+	// Frame Rate Control
+	MIPI_DBI_CMD(0xB2, 0x12), // HPM=32hz ; LPM=1hz
 
-	return 0;
-}
+	MIPI_DBI_CMD(0xB0, 0x60), // Gate Line Setting: 384 line
+	MIPI_DBI_END,
+};
 
-static const struct drm_display_mode ydp213h001_v3_mode = {
-	DRM_SIMPLE_MODE(122, 250, 24, 49),
+static const struct st7305_panel_desc ydp290h001_v3_desc = {
+	.panel = &ydp290h001_v3_panel,
+	.init_table = ydp290h001_v3_init_table,
 };
 
-static const struct st7305_panel_desc ydp213h001_v3_desc = {
-	.mode = &ydp213h001_v3_mode,
+static const u8 w420hc018mono_12z_init_table[] = {
+	MIPI_DBI_CMD(0xD6, 0x17, 0x02), // NVM Load Control
+	MIPI_DBI_CMD(0xC0, 0x11, 0x04), // Gate Voltage Setting
 
-	.caset[0] = 0x19,
-	.caset[1] = 0x23,
+	MIPI_DBI_CMD(0xC1, 0x37, 0x37, 0x37, 0x37), // VSHP Setting (4.8V)
+	MIPI_DBI_CMD(0xC2, 0x19, 0x19, 0x19, 0x19), // VSLP Setting (0.5V)
+	MIPI_DBI_CMD(0xC4, 0x41, 0x41, 0x41, 0x41), // VSHN Setting (-3.8V)
+	MIPI_DBI_CMD(0xC5, 0x19, 0x19, 0x19, 0x19), // VSLN Setting (0.5V)
 
-	.raset[0] = 0x00,
-	.raset[1] = 0x7C,
+	MIPI_DBI_CMD(0x35, 0x00),
+	MIPI_DBI_CMD(0xD8, 0xA6, 0xE9),
+	MIPI_DBI_CMD(0xB0, 0x64), // Gate Line Setting: 400 line
+	MIPI_DBI_END,
+};
 
-	.left_offset = 10,
+static const struct st7305_panel_desc w420hc018mono_12z_desc = {
+	.panel = &w420hc018mono_12z_panel,
+	.init_table = w420hc018mono_12z_init_table,
+};
 
-	.page_size = 33, // 122/4=30.5≈33 (3 bytes per write)
-	.page_count = 125, // 252/2=125
+static const u8 ydp420h001_v3_init_table[] = {
+	MIPI_DBI_CMD(0xD6, 0x17, 0x02), // NVM Load Control
+	MIPI_DBI_CMD(0xC0, 0x11, 0x04), // Gate Voltage Setting
+	// VSHP Setting (4.8V)
+	MIPI_DBI_CMD(0xC1, 0x37, 0X37, 0X37, 0X37),
+	// VSLP Setting (0.5V)
+	MIPI_DBI_CMD(0xC2, 0X19, 0X19, 0X19, 0X19),
+	// VSHN Setting (-3.8V)
+	MIPI_DBI_CMD(0xC4, 0X41, 0X41, 0X41, 0X41),
+	// VSLN Setting (0.5V)
+	MIPI_DBI_CMD(0xC5, 0X19, 0X19, 0X19, 0X19),
 
-	.bufsize = 33 * 125,
+	MIPI_DBI_CMD(0xB0, 0x64), // Gate Line Setting: 400 line
+	MIPI_DBI_END,
+};
 
-	.init_seq = ydp213h001_v3_init_seq,
-	.draw_pixel = st7305_draw_pixel,
+static const struct st7305_panel_desc ydp420h001_v3_desc = {
+	.panel = &ydp420h001_v3_panel,
+	.init_table = ydp420h001_v3_init_table,
 };
 
-static int ydp290h001_v3_init_seq(struct st7305 *st7305)
+#ifdef CONFIG_DEBUG_FS
+static int st7305_power_mode_show(struct seq_file *m, void *arg)
 {
-	struct mipi_dbi *dbi = st7305->dbi;
-
-	mipi_dbi_command(dbi, 0xD6, 0x17, 0x02); // NVM Load Control
-
-	mipi_dbi_command(dbi, 0xD8, 0xA6, 0xE9);
-	// Frame Rate Control
-	mipi_dbi_command(dbi, 0xB2, 0x12); // HPM=32hz ; LPM=1hz
-
-	mipi_dbi_command(dbi, 0xB0, 0x60); // Gate Line Setting: 384 line
+	struct st7305 *st7305 = m->private;
+	u64 resume_bytes;
+
+	spin_lock_irq(&st7305->stats_lock);
+	resume_bytes = st7305->resume_bytes;
+	spin_unlock_irq(&st7305->stats_lock);
+
+	mutex_lock(&st7305->pm_lock);
+	if (st7305->pm_active)
+		st7305_pm_account(st7305, ktime_get());
+
+	seq_printf(m, "mode: %s\n", !st7305->pm_active ? "off" :
+		   st7305->lpm ? "lpm" : "hpm");
+	seq_printf(m, "hpm_ms: %llu\n", div_u64(st7305->hpm_us, 1000));
+	seq_printf(m, "lpm_ms: %llu\n", div_u64(st7305->lpm_us, 1000));
+	seq_printf(m, "transitions: %llu\n", st7305->pm_transitions);
+	seq_printf(m, "lpm_enter_us: %lld (max %lld)\n",
+		   st7305->lpm_enter_us, st7305->lpm_enter_max_us);
+	seq_printf(m, "lpm_exit_us: %lld (max %lld)\n",
+		   st7305->lpm_exit_us, st7305->lpm_exit_max_us);
+	seq_printf(m, "panel: %s\n", !st7305->panel_ready ? "uninitialized" :
+		   st7305->asleep ? "sleep" : "awake");
+	seq_printf(m, "resume_cold: %llu\n", st7305->resume_cold);
+	seq_printf(m, "resume_fast: %llu\n", st7305->resume_fast);
+	seq_printf(m, "resume_us: %lld\n", st7305->resume_us);
+	seq_printf(m, "resume_ram_bytes: %llu\n", resume_bytes);
+	mutex_unlock(&st7305->pm_lock);
 
 	return 0;
 }
-
-static const struct drm_display_mode ydp290h001_v3_mode = {
-	DRM_SIMPLE_MODE(168, 384, 29, 67),
+DEFINE_SHOW_ATTRIBUTE(st7305_power_mode);
+
+static const struct {
+	const char *name;
+	u32 div; // ns to us for the timings
+} st7305_stat_names[ST7305_STAT_MAX] = {
+	[ST7305_STAT_COPY] = { "copy_us", 1000 },
+	[ST7305_STAT_CONVERT] = { "convert_us", 1000 },
+	[ST7305_STAT_PACK] = { "pack_us", 1000 },
+	[ST7305_STAT_TE_WAIT] = { "te_wait_us", 1000 },
+	[ST7305_STAT_CMD] = { "cmd_us", 1000 },
+	[ST7305_STAT_SPI] = { "spi_us", 1000 },
+	[ST7305_STAT_DAMAGE] = { "damage_px", 1 },
+	[ST7305_STAT_BYTES] = { "flush_bytes", 1 },
 };
 
-static const struct st7305_panel_desc ydp290h001_v3_desc = {
-	.mode = &ydp290h001_v3_mode,
-
-	.caset[0] = 0x17,
-	.caset[1] = 0x24, // 0X24-0X17=14 // 14*4*3=168
-
-	.raset[0] = 0x00,
-	.raset[1] = 0xBF, // 192*2=384
-
-	.left_offset = 0,
+static int st7305_stats_show(struct seq_file *m, void *arg)
+{
+	struct st7305 *st7305 = m->private;
+	u64 bytes_sent, bytes_skipped, frames_coalesced;
+	u64 count, min, avg, p99, max;
+	struct st7305_hist *h;
+	u32 div;
+	int i;
+
+	seq_printf(m, "%-12s %10s %10s %10s %10s %10s\n", "stage", "count",
+		   "min", "avg", "p99", "max");
+
+	for (i = 0; i < ST7305_STAT_MAX; i++) {
+		h = &st7305->stats[i];
+		div = st7305_stat_names[i].div;
+
+		spin_lock_irq(&st7305->stats_lock);
+		count = h->count;
+		min = count ? h->min : 0;
+		avg = count ? div64_u64(h->sum, count) : 0;
+		p99 = st7305_hist_percentile(h, 99);
+		max = h->max;
+		spin_unlock_irq(&st7305->stats_lock);
+
+		seq_printf(m, "%-12s %10llu %10llu %10llu %10llu %10llu\n",
+			   st7305_stat_names[i].name, count,
+			   div_u64(min, div), div_u64(avg, div),
+			   div_u64(p99, div), div_u64(max, div));
+	}
 
-	.page_size = 42, // 168/8*2=42
-	.page_count = 192,
+	/* one snapshot, a u64 read can tear on 32-bit */
+	spin_lock_irq(&st7305->stats_lock);
+	bytes_sent = st7305->bytes_sent;
+	bytes_skipped = st7305->bytes_skipped;
+	frames_coalesced = st7305->frames_coalesced;
+	spin_unlock_irq(&st7305->stats_lock);
 
-	.bufsize = 42 * 192,
+	seq_printf(m, "bytes_sent: %llu\n", bytes_sent);
+	seq_printf(m, "bytes_skipped: %llu\n", bytes_skipped);
+	seq_printf(m, "frames_coalesced: %llu\n", frames_coalesced);
 
-	.init_seq = ydp290h001_v3_init_seq,
-	.draw_pixel = st7305_draw_pixel,
-};
+	return 0;
+}
 
-static int w420hc018mono_12z_init_seq(struct st7305 *st7305)
+static int st7305_stats_open(struct inode *inode, struct file *file)
 {
-	struct mipi_dbi *dbi = st7305->dbi;
-
-	mipi_dbi_command(dbi, 0xD6, 0x17, 0x02); // NVM Load Control
-	mipi_dbi_command(dbi, 0xC0, 0x11, 0x04); // Gate Voltage Setting
-
-	mipi_dbi_command(dbi, 0xC1, 0x37, 0x37, 0x37,
-			 0x37); // VSHP Setting (4.8V)
-	mipi_dbi_command(dbi, 0xC2, 0x19, 0x19, 0x19,
-			 0x19); // VSLP Setting (0.5V)
-	mipi_dbi_command(dbi, 0xC4, 0x41, 0x41, 0x41,
-			 0x41); // VSHN Setting (-3.8V)
-	mipi_dbi_command(dbi, 0xC5, 0x19, 0x19, 0x19,
-			 0x19); // VSLN Setting (0.5V)
+	return single_open(file, st7305_stats_show, inode->i_private);
+}
 
-	mipi_dbi_command(dbi, 0x35, 0x00);
-	mipi_dbi_command(dbi, 0xD8, 0xA6, 0xE9);
-	mipi_dbi_command(dbi, 0xB0, 0x64); // Gate Line Setting: 400 line
+/* Any write clears the histograms and the counters */
+static ssize_t st7305_stats_write(struct file *file, const char __user *ubuf,
+				  size_t count, loff_t *ppos)
+{
+	struct seq_file *m = file->private_data;
+	struct st7305 *st7305 = m->private;
+	int i;
+
+	spin_lock_irq(&st7305->stats_lock);
+	for (i = 0; i < ST7305_STAT_MAX; i++)
+		st7305_hist_reset(&st7305->stats[i]);
+	st7305->bytes_sent = 0;
+	st7305->bytes_skipped = 0;
+	st7305->frames_coalesced = 0;
+	spin_unlock_irq(&st7305->stats_lock);
 
-	return 0;
+	return count;
 }
 
-static const struct drm_display_mode w420hc018mono_12z_mode = {
-	DRM_SIMPLE_MODE(300, 400, 64, 85),
+static const struct file_operations st7305_stats_fops = {
+	.owner = THIS_MODULE,
+	.open = st7305_stats_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+	.write = st7305_stats_write,
 };
 
-static const struct st7305_panel_desc w420hc018mono_12z_desc = {
-	.mode = &w420hc018mono_12z_mode,
-
-	.caset[0] = 0x05,
-	.caset[1] = 0x36,
+/*
+ * Converts full frames for 50 ms, returns the number of frames. The stage
+ * times are dropped, the flush statistics only cover real flushes.
+ */
+static int st7305_bench_run(struct st7305 *st7305, u8 *dst,
+			    const struct st7305_src *src,
+			    const struct drm_rect *clip, u8 type, s64 *ns)
+{
+	ktime_t start = ktime_get();
+	u64 convert_ns = 0, pack_ns = 0;
+	int frames = 0;
+
+	do {
+		/* line_buf and the error rows */
+		mutex_lock(&st7305->buf_lock);
+		st7305_fb_to_mono(&st7305->conv, dst, src, clip, type,
+				  st7305_use_neon(), &convert_ns, &pack_ns);
+		mutex_unlock(&st7305->buf_lock);
+		frames++;
+		*ns = ktime_to_ns(ktime_sub(ktime_get(), start));
+	} while (*ns < 50 * NSEC_PER_MSEC);
+
+	return frames;
+}
 
-	.raset[0] = 0x00,
-	.raset[1] = 0xC7,
+/*
+ * Runs the conversion and packing of a full frame for every format, pattern,
+ * source memory type and dither type at the panel geometry. "wc" sources are
+ * write-combined like CMA framebuffers, "cached" ones like shmem. One line of
+ * key=value pairs per run, so results from different builds can be diffed.
+ * use_neon selects the path.
+ */
+static int st7305_bench_show(struct seq_file *m, void *arg)
+{
+	static const char * const patterns[] = { "ramp", "noise" };
+	static const char * const mems[] = { "cached", "wc" };
+	struct st7305 *st7305 = m->private;
+	struct drm_display_mode *mode = &st7305->dbidev->mode;
+	struct st7305_src fb = {
+		.rotation = st7305->dbidev->rotation,
+	};
+	struct drm_rect clip = {
+		.x2 = st7305->desc->panel->width,
+		.y2 = st7305->desc->panel->height,
+	};
+	uint width = mode->hdisplay, height = mode->vdisplay;
+	uint pixels = width * height;
+	int f, pattern, mem, type, frames;
+	void *src[ARRAY_SIZE(mems)];
+	int ret = -ENOMEM;
+	dma_addr_t dma;
+	u8 *gray, *dst;
+	u64 kpix;
+	s64 ns;
+
+	gray = kvmalloc(pixels, GFP_KERNEL);
+	dst = kvmalloc(st7305_panel_bufsize(st7305->desc->panel), GFP_KERNEL);
+	src[0] = kvmalloc(pixels * 4, GFP_KERNEL);
+	src[1] = dma_alloc_wc(st7305->dev, pixels * 4, &dma, GFP_KERNEL);
+	if (!gray || !dst || !src[0] || !src[1])
+		goto out_free;
+
+	for (f = 0; f < ARRAY_SIZE(st7305_formats); f++) {
+		fb.format = st7305_formats[f];
+
+		for (pattern = 0; pattern < ARRAY_SIZE(patterns); pattern++) {
+			st7305_bench_fill(gray, width, height, pattern);
+
+			for (mem = 0; mem < ARRAY_SIZE(mems); mem++) {
+				fb.vaddr = src[mem];
+				fb.bounce = mem == 1;
+				fb.pitch = st7305_bench_format(src[mem], gray,
+							       width, height,
+							       fb.format);
+
+				for (type = 0; type < DITHER_TYPE_MAX; type++) {
+					frames = st7305_bench_run(st7305, dst,
+								  &fb, &clip,
+								  type, &ns);
+					kpix = div64_u64((u64)pixels * frames *
+							 USEC_PER_SEC, ns);
+					seq_printf(m, "w=%u h=%u format=%.4s rot=%u pattern=%s mem=%s dither=%s neon=%d frames=%d ns_per_frame=%lld mpix_s=%llu.%03llu\n",
+						   width, height,
+						   (const char *)&fb.format,
+						   fb.rotation,
+						   patterns[pattern], mems[mem],
+						   dither_get_name(type),
+						   st7305_use_neon(), frames,
+						   div_s64(ns, frames),
+						   kpix / 1000, kpix % 1000);
+				}
+			}
+		}
+	}
+	ret = 0;
 
-	.left_offset = 144,
+out_free:
+	if (src[1])
+		dma_free_wc(st7305->dev, pixels * 4, src[1], dma);
+	kvfree(src[0]);
+	kvfree(dst);
+	kvfree(gray);
 
-	.page_size = 150,
-	.page_count = 200,
+	return ret;
+}
 
-	.bufsize = 150 * 200,
+static int st7305_bench_open(struct inode *inode, struct file *file)
+{
+	return single_open_size(file, st7305_bench_show, inode->i_private,
+				SZ_32K);
+}
 
-	.init_seq = w420hc018mono_12z_init_seq,
-	.draw_pixel = st7305_draw_pixel,
+static const struct file_operations st7305_bench_fops = {
+	.owner = THIS_MODULE,
+	.open = st7305_bench_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
 };
 
-static int ydp420h001_v3_init_seq(struct st7305 *st7305)
+static int st7305_emu_state_show(struct seq_file *m, void *arg)
 {
-	struct mipi_dbi *dbi = st7305->dbi;
-
-	mipi_dbi_command(dbi, 0xD6, 0x17, 0x02); // NVM Load Control
-	mipi_dbi_command(dbi, 0xC0, 0x11, 0x04); // Gate Voltage Setting
-	// VSHP Setting (4.8V)
-	mipi_dbi_command(dbi, 0xC1, 0x37, 0X37, 0X37, 0X37);
-	// VSLP Setting (0.5V)
-	mipi_dbi_command(dbi, 0xC2, 0X19, 0X19, 0X19, 0X19);
-	// VSHN Setting (-3.8V)
-	mipi_dbi_command(dbi, 0xC4, 0X41, 0X41, 0X41, 0X41);
-	// VSLN Setting (0.5V)
-	mipi_dbi_command(dbi, 0xC5, 0X19, 0X19, 0X19, 0X19);
-
-	mipi_dbi_command(dbi, 0xB0, 0x64); // Gate Line Setting: 400 line
+	struct st7305 *st7305 = m->private;
 
+	st7305_emu_show(st7305->emu, m);
 	return 0;
 }
+DEFINE_SHOW_ATTRIBUTE(st7305_emu_state);
 
-static const struct drm_display_mode ydp420h001_v3_mode = {
-	DRM_SIMPLE_MODE(300, 400, 64, 85),
-};
+static int st7305_emu_pbm_show(struct seq_file *m, void *arg)
+{
+	struct st7305 *st7305 = m->private;
+	size_t len;
+	u8 *buf;
 
-static const struct st7305_panel_desc ydp420h001_v3_desc = {
-	.mode = &ydp420h001_v3_mode,
+	buf = kvmalloc(st7305_emu_pbm_size(st7305->emu), GFP_KERNEL);
+	if (!buf)
+		return -ENOMEM;
 
-	.caset[0] = 0x05,
-	.caset[1] = 0x36,
+	len = st7305_emu_render_pbm(st7305->emu, buf);
+	seq_write(m, buf, len);
+	kvfree(buf);
 
-	.raset[0] = 0x00,
-	.raset[1] = 0xC7,
+	return 0;
+}
 
-	.left_offset = 0,
+static int st7305_emu_pbm_open(struct inode *inode, struct file *file)
+{
+	struct st7305 *st7305 = inode->i_private;
 
-	.page_size = 150,
-	.page_count = 200,
+	return single_open_size(file, st7305_emu_pbm_show, st7305,
+				st7305_emu_pbm_size(st7305->emu));
+}
 
-	.bufsize = 150 * 200,
+static const struct file_operations st7305_emu_pbm_fops = {
+	.owner = THIS_MODULE,
+	.open = st7305_emu_pbm_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
 
-	.init_seq = ydp420h001_v3_init_seq,
+static void st7305_debugfs_init(struct drm_minor *minor)
+{
+	struct mipi_dbi_dev *dbidev = drm_to_mipi_dbi_dev(minor->dev);
+	struct st7305 *st7305 = dbidev_to_st7305(dbidev);
 
-	/*
-	 * The ST7306 supports multi-color displays, and while its internal
-	 * display RAM layout differs slightly from the ST7305, the two are
-	 * otherwise largely compatible.
-	 */
-	.draw_pixel = st7306_draw_pixel,
-};
+	mipi_dbi_debugfs_init(minor);
+
+	debugfs_create_file("power_mode", 0444, minor->debugfs_root, st7305,
+			    &st7305_power_mode_fops);
+	debugfs_create_u32("te_rate_mhz", 0444, minor->debugfs_root,
+			   &st7305->te_mhz);
+	debugfs_create_file("stats", 0644, minor->debugfs_root, st7305,
+			    &st7305_stats_fops);
+	debugfs_create_file("bench", 0400, minor->debugfs_root, st7305,
+			    &st7305_bench_fops);
+
+	if (st7305->emu) {
+		debugfs_create_file("emu_state", 0444, minor->debugfs_root,
+				    st7305, &st7305_emu_state_fops);
+		debugfs_create_file("emu_frame.pbm", 0444,
+				    minor->debugfs_root, st7305,
+				    &st7305_emu_pbm_fops);
+	}
+}
+#else
+#define st7305_debugfs_init NULL
+#endif
 
 DEFINE_DRM_GEM_CMA_FOPS(st7305_fops);
 
@@ -643,7 +1650,7 @@ static struct drm_driver st7305_driver = {
 	.driver_features = DRIVER_GEM | DRIVER_MODESET | DRIVER_ATOMIC,
 	.fops = &st7305_fops,
 	DRM_GEM_CMA_DRIVER_OPS_VMAP,
-	.debugfs_init = mipi_dbi_debugfs_init,
+	.debugfs_init = st7305_debugfs_init,
 	.name = "st7305",
 	.desc = "Sitronix ST7305",
 	.date = "20251022",
@@ -651,6 +1658,26 @@ static struct drm_driver st7305_driver = {
 	.minor = 0,
 };
 
+#if IS_ENABLED(CONFIG_DRM_GEM_SHMEM_HELPER)
+DEFINE_DRM_GEM_FOPS(st7305_shmem_fops);
+
+/* Same device, cached pages the CPU reads at full speed */
+static struct drm_driver st7305_shmem_driver = {
+	.driver_features = DRIVER_GEM | DRIVER_MODESET | DRIVER_ATOMIC,
+	.fops = &st7305_shmem_fops,
+	DRM_GEM_SHMEM_DRIVER_OPS,
+	.gem_create_object = drm_gem_shmem_create_object_cached,
+	.debugfs_init = st7305_debugfs_init,
+	.name = "st7305",
+	.desc = "Sitronix ST7305",
+	.date = "20251022",
+	.major = 1,
+	.minor = 0,
+};
+#else
+#define st7305_shmem_driver st7305_driver
+#endif
+
 static const struct of_device_id st7305_of_match[] = {
 	{ .compatible = "sitronix,st7305", .data = &ydp290h001_v3_desc },
 
@@ -683,7 +1710,8 @@ MODULE_DEVICE_TABLE(spi, st7305_id);
 
 static int st7305_probe(struct spi_device *spi)
 {
-	const struct drm_display_mode *mode;
+	const struct st7305_panel *panel;
+	struct drm_display_mode mode;
 	struct device *dev = &spi->dev;
 	struct mipi_dbi_dev *dbidev;
 	struct drm_device *drm;
@@ -695,13 +1723,14 @@ static int st7305_probe(struct spi_device *spi)
 	size_t bufsize;
 	int ret;
 	int irq;
+	int i;
 
 	st7305 = devm_kzalloc(dev, sizeof(*st7305), GFP_KERNEL);
 	if (IS_ERR(st7305))
 		return -ENOMEM;
 
-	dbidev = devm_drm_dev_alloc(dev, &st7305_driver, struct mipi_dbi_dev,
-				    drm);
+	dbidev = devm_drm_dev_alloc(dev, gem_shmem ? &st7305_shmem_driver :
+				    &st7305_driver, struct mipi_dbi_dev, drm);
 	if (IS_ERR(dbidev))
 		return PTR_ERR(dbidev);
 
@@ -719,19 +1748,42 @@ static int st7305_probe(struct spi_device *spi)
 	st7305->dither_type = DITHER_TYPE_NONE;
 	// st7305->dither_type = DITHER_TYPE_BAYER_16X16;
 
-	mode = st7305->desc->mode;
-	width = mode->hdisplay;
-	height = mode->vdisplay;
-	bufsize = st7305->desc->bufsize;
+	panel = st7305->desc->panel;
+	width = panel->width;
+	height = panel->height;
+	bufsize = st7305_panel_bufsize(panel);
 	dev_info(dev, "bufsize: %zu (bytes)\n", bufsize);
 
+	mode = (struct drm_display_mode){
+		DRM_SIMPLE_MODE(width, height, panel->width_mm,
+				panel->height_mm),
+	};
+
+	ret = st7305_convert_init(dev, &st7305->conv, panel);
+	if (ret)
+		return ret;
+
+	st7305->win_buf = devm_kmalloc(dev, bufsize, GFP_KERNEL);
+	if (!st7305->win_buf)
+		return -ENOMEM;
+
+	mutex_init(&st7305->buf_lock);
+	INIT_DELAYED_WORK(&st7305->flush_work, st7305_flush_worker);
+	mutex_init(&st7305->pm_lock);
+	spin_lock_init(&st7305->stats_lock);
+	for (i = 0; i < ST7305_STAT_MAX; i++)
+		st7305_hist_reset(&st7305->stats[i]);
+	INIT_DELAYED_WORK(&st7305->idle_work, st7305_idle_worker);
+	st7305->flush_async.complete = st7305_flush_done;
+
 	dbi->reset = devm_gpiod_get(dev, "reset", GPIOD_OUT_LOW);
 	if (IS_ERR(dbi->reset)) {
 		DRM_DEV_ERROR(dev, "Failed to get gpio 'reset'\n");
 		return PTR_ERR(dbi->reset);
 	}
 
-	st7305->te = devm_gpiod_get(dev, "te", GPIOD_IN);
+	/* an emulated panel has no TE to wait for */
+	st7305->te = emulate ? NULL : devm_gpiod_get(dev, "te", GPIOD_IN);
 	if (IS_ERR(st7305->te)) {
 		DRM_DEV_INFO(dev, "Device doesn't support TE\b");
 		st7305->te = NULL;
@@ -740,8 +1792,10 @@ static int st7305_probe(struct spi_device *spi)
 	if (st7305->te) {
 		dev_info(dev, "Device supports TE\n");
 		init_completion(&st7305->refresh_done);
+		INIT_DELAYED_WORK(&st7305->te_work, st7305_te_worker);
 
 		irq = gpiod_to_irq(st7305->te);
+		st7305->te_irq = irq;
 		ret = devm_request_threaded_irq(
 			dev, irq, NULL, st7305_irq_handler,
 			IRQF_TRIGGER_RISING | IRQF_ONESHOT, DRV_NAME "-te",
@@ -769,6 +1823,10 @@ static int st7305_probe(struct spi_device *spi)
 	device_property_read_u32(dev, "rotation", &rotation);
 	dev_info(dev, "rotation: %d\n", rotation);
 
+	ret = st7305_flush_init(dev, &st7305->flush, panel, rotation);
+	if (ret)
+		return ret;
+
 	ret = mipi_dbi_spi_init(spi, dbi, dc);
 	if (ret)
 		return ret;
@@ -776,21 +1834,42 @@ static int st7305_probe(struct spi_device *spi)
 	/* SDO signal is not available on this panel. */
 	dbi->read_commands = NULL;
 
+	if (emulate) {
+		ret = st7305_emu_setup(st7305);
+		if (ret)
+			return ret;
+	}
+
 	ret = mipi_dbi_dev_init_with_formats(dbidev, &st7305_pipe_funcs,
 					     st7305_formats,
-					     ARRAY_SIZE(st7305_formats), mode,
+					     ARRAY_SIZE(st7305_formats), &mode,
 					     rotation, bufsize);
 	if (ret)
 		return ret;
 
+	if (st7305->te) {
+		ret = drm_vblank_init(drm, 1);
+		if (ret)
+			return ret;
+	}
+
+	/* partial updates send the padding bytes around the visible area */
+	memset(dbidev->tx_buf, 0, bufsize);
+
 	drm_mode_config_reset(drm);
 
+	/* debugfs_init() runs from drm_dev_register() and needs the drvdata */
+	spi_set_drvdata(spi, st7305);
+	dev_set_drvdata(dev, st7305);
+
 	ret = drm_dev_register(drm, 0);
 	if (ret)
 		return ret;
 
-	spi_set_drvdata(spi, st7305);
-	dev_set_drvdata(dev, st7305);
+	/* the panel is cold, the first enable does the full init */
+	pm_runtime_set_autosuspend_delay(dev, ST7305_AUTOSUSPEND_MS);
+	pm_runtime_use_autosuspend(dev);
+	pm_runtime_enable(dev);
 
 	drm_fbdev_generic_setup(drm, 0);
 
@@ -813,8 +1892,21 @@ static int st7305_remove(struct spi_device *spi)
 
 	sysfs_remove_group(&st7305->dev->kobj, &st7305_attr_group);
 
-	drm_dev_unplug(drm);
+	/*
+	 * Shut down first: the disable flushes the worker, which still gets
+	 * to the panel and sends a parked page flip event.
+	 */
 	drm_atomic_helper_shutdown(drm);
+	drm_dev_unplug(drm);
+	pm_runtime_dont_use_autosuspend(st7305->dev);
+	pm_runtime_disable(st7305->dev);
+	cancel_delayed_work_sync(&st7305->flush_work);
+	cancel_delayed_work_sync(&st7305->idle_work);
+	mipi_dbi_async_wait(st7305->dbi);
+
+	/* the worker bails out once the device is unplugged */
+	if (st7305->damage_fb)
+		drm_framebuffer_put(st7305->damage_fb);
 
 	return 0;
 }
@@ -825,11 +1917,16 @@ static void st7305_shutdown(struct spi_device *spi)
 	drm_atomic_helper_shutdown(st7305->drm);
 }
 
+static const struct dev_pm_ops st7305_pm_ops = {
+	SET_RUNTIME_PM_OPS(st7305_runtime_suspend, st7305_runtime_resume, NULL)
+};
+
 static struct spi_driver st7305_spi_driver = {
 	.driver =
 	{
 		.name = DRV_NAME,
 		.of_match_table = st7305_of_match,
+		.pm = &st7305_pm_ops,
 	},
 	.id_table = st7305_id,
 	.probe = st7305_probe,
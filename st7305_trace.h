@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM st7305
+
+#if !defined(__ST7305_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define __ST7305_TRACE_H
+
+#include <linux/tracepoint.h>
+
+#include <drm/drm_rect.h>
+
+/*
+ * Flush pipeline of the st7305 driver, from the atomic update down to the
+ * SPI writes, see Documentation/trace/events.rst. The DCS commands are
+ * traced by the MIPI DBI core, see drm_mipi_dbi_trace.h.
+ */
+
+DECLARE_EVENT_CLASS(st7305_fb,
+	TP_PROTO(u32 fb_id, const struct drm_rect *clip, u8 dither),
+	TP_ARGS(fb_id, clip, dither),
+
+	TP_STRUCT__entry(
+		__field(u32, fb_id)
+		__field(int, x1)
+		__field(int, y1)
+		__field(int, x2)
+		__field(int, y2)
+		__field(u8, dither)
+	),
+
+	TP_fast_assign(
+		__entry->fb_id = fb_id;
+		__entry->x1 = clip ? clip->x1 : 0;
+		__entry->y1 = clip ? clip->y1 : 0;
+		__entry->x2 = clip ? clip->x2 : 0;
+		__entry->y2 = clip ? clip->y2 : 0;
+		__entry->dither = dither;
+	),
+
+	TP_printk("fb=%u clip=%dx%d+%d+%d dither=%u", __entry->fb_id,
+		  __entry->x2 - __entry->x1, __entry->y2 - __entry->y1,
+		  __entry->x1, __entry->y1, __entry->dither)
+);
+
+/* Damage in framebuffer coordinates, none when the pipe is off */
+DEFINE_EVENT(st7305_fb, st7305_update_begin,
+	TP_PROTO(u32 fb_id, const struct drm_rect *clip, u8 dither),
+	TP_ARGS(fb_id, clip, dither)
+);
+
+DEFINE_EVENT(st7305_fb, st7305_update_end,
+	TP_PROTO(u32 fb_id, const struct drm_rect *clip, u8 dither),
+	TP_ARGS(fb_id, clip, dither)
+);
+
+/* Conversion into tx_buf, clip in panel coordinates */
+DEFINE_EVENT(st7305_fb, st7305_convert_begin,
+	TP_PROTO(u32 fb_id, const struct drm_rect *clip, u8 dither),
+	TP_ARGS(fb_id, clip, dither)
+);
+
+DEFINE_EVENT(st7305_fb, st7305_convert_end,
+	TP_PROTO(u32 fb_id, const struct drm_rect *clip, u8 dither),
+	TP_ARGS(fb_id, clip, dither)
+);
+
+/* RAM window in CASET units and pages, with the bytes about to be sent */
+TRACE_EVENT(st7305_flush,
+	TP_PROTO(const struct drm_rect *win, int runs, size_t bytes),
+	TP_ARGS(win, runs, bytes),
+
+	TP_STRUCT__entry(
+		__field(int, x1)
+		__field(int, y1)
+		__field(int, x2)
+		__field(int, y2)
+		__field(int, runs)
+		__field(size_t, bytes)
+	),
+
+	TP_fast_assign(
+		__entry->x1 = win->x1;
+		__entry->y1 = win->y1;
+		__entry->x2 = win->x2;
+		__entry->y2 = win->y2;
+		__entry->runs = runs;
+		__entry->bytes = bytes;
+	),
+
+	TP_printk("cols=%d-%d pages=%d-%d runs=%d bytes=%zu", __entry->x1,
+		  __entry->x2 - 1, __entry->y1, __entry->y2 - 1, __entry->runs,
+		  __entry->bytes)
+);
+
+TRACE_EVENT(st7305_te,
+	TP_PROTO(u32 count),
+	TP_ARGS(count),
+
+	TP_STRUCT__entry(
+		__field(u32, count)
+	),
+
+	TP_fast_assign(
+		__entry->count = count;
+	),
+
+	TP_printk("count=%u", __entry->count)
+);
+
+#endif /* __ST7305_TRACE_H */
+
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE st7305_trace
+#include <trace/define_trace.h>
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Checks the line converters of dither.c on the host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+
+#include "dither.h"
+
+#define MAX_WIDTH 400
+
+/*
+ * drm_fourcc.h documents R1 as [7:0] R0:R1:R2:R3:R4:R5:R6:R7, pixel 0 is
+ * the most significant bit.
+ */
+static int check_r1(void)
+{
+	u8 src[MAX_WIDTH / 8], dst[MAX_WIDTH];
+	uint x, width, i;
+
+	/* a single white pixel walks through the line */
+	for (x = 0; x < MAX_WIDTH; x++) {
+		memset(src, 0, sizeof(src));
+		src[x / 8] = 0x80 >> (x % 8);
+
+		dither_r1_line_to_bw(dst, src, 0, MAX_WIDTH);
+		for (i = 0; i < MAX_WIDTH; i++)
+			if (dst[i] != (i == x ? 0xFF : 0x00))
+				goto fail;
+	}
+
+	/* any start column, against a bit by bit read of the line */
+	for (i = 0; i < sizeof(src); i++)
+		src[i] = rand();
+	for (x = 0; x < MAX_WIDTH; x++) {
+		width = rand() % (MAX_WIDTH - x + 1);
+		dither_r1_line_to_bw(dst, src, x, width);
+		for (i = 0; i < width; i++) {
+			uint bit = 7 - (x + i) % 8;
+
+			if (dst[i] != ((src[(x + i) / 8] >> bit) & 1 ? 0xFF : 0))
+				goto fail;
+		}
+	}
+
+	printf("r1: ok\n");
+	return 0;
+
+fail:
+	printf("r1: x=%u: FAIL\n", x);
+	return 1;
+}
+
+/* The error diffusion weights of dither.c, see struct dither_ed_kernel */
+static const struct {
+	u8 type;
+	int shift, r1, r2, dl, d, dr, d2;
+} ed_kernels[] = {
+	{ DITHER_TYPE_FLOYD_STEINBERG, 4, 7, 0, 3, 5, 1, 0 },
+	{ DITHER_TYPE_ATKINSON, 3, 1, 1, 1, 1, 1, 1 },
+	{ DITHER_TYPE_SIERRA_LITE, 2, 2, 0, 1, 1, 0, 0 },
+};
+
+#define ED_WIDTH 300
+#define ED_HEIGHT 400
+
+/* Full frame integer error diffusion, error leaving the frame is dropped */
+static void ed_reference(int k, const u8 *src, u8 *dst)
+{
+	static int err[ED_HEIGHT + 2][ED_WIDTH];
+	int shift = ed_kernels[k].shift;
+	int x, y, v, e;
+
+	memset(err, 0, sizeof(err));
+
+#define SPREAD(dx, dy, w)						\
+	do {								\
+		if (x + (dx) >= 0 && x + (dx) < ED_WIDTH)		\
+			err[y + (dy)][x + (dx)] += (w) * e;		\
+	} while (0)
+
+	for (y = 0; y < ED_HEIGHT; y++) {
+		for (x = 0; x < ED_WIDTH; x++) {
+			v = src[y * ED_WIDTH + x] +
+			    ((err[y][x] + (1 << (shift - 1))) >> shift);
+			dst[y * ED_WIDTH + x] = v > 0x7F ? 0xFF : 0x00;
+			e = v - dst[y * ED_WIDTH + x];
+
+			SPREAD(1, 0, ed_kernels[k].r1);
+			SPREAD(2, 0, ed_kernels[k].r2);
+			SPREAD(-1, 1, ed_kernels[k].dl);
+			SPREAD(0, 1, ed_kernels[k].d);
+			SPREAD(1, 1, ed_kernels[k].dr);
+			SPREAD(0, 2, ed_kernels[k].d2);
+		}
+	}
+#undef SPREAD
+}
+
+/* The line by line error diffusion matches a full frame reference */
+static int check_ed(void)
+{
+	static u8 src[ED_WIDTH * ED_HEIGHT];
+	static u8 ref[ED_WIDTH * ED_HEIGHT], out[ED_WIDTH * ED_HEIGHT];
+	struct dither_ed ed;
+	uint i, y, k, pattern;
+	int ret = 0;
+
+	if (dither_ed_init(NULL, &ed, ED_WIDTH))
+		return 1;
+
+	for (pattern = 0; pattern < 2; pattern++) {
+		for (i = 0; i < ED_WIDTH * ED_HEIGHT; i++)
+			src[i] = pattern ? rand() :
+				 (i % ED_WIDTH * 255 / ED_WIDTH +
+				  i / ED_WIDTH * 255 / ED_HEIGHT) / 2;
+
+		for (k = 0; k < ARRAY_SIZE(ed_kernels); k++) {
+			ed_reference(k, src, ref);
+			for (y = 0; y < ED_HEIGHT; y++)
+				dither_ed_gray8_line_to_bw(&ed,
+						ed_kernels[k].type,
+						out + y * ED_WIDTH,
+						src + y * ED_WIDTH, y,
+						ED_WIDTH);
+
+			if (memcmp(ref, out, sizeof(ref))) {
+				printf("ed %s: pattern %u: FAIL\n",
+				       dither_get_name(ed_kernels[k].type),
+				       pattern);
+				ret = 1;
+			}
+		}
+	}
+
+	if (!ret)
+		printf("ed: ok\n");
+
+	return ret;
+}
+
+int main(void)
+{
+	int ret = 0;
+
+	srand(1);
+
+	ret |= check_r1();
+	ret |= check_ed();
+
+	return ret;
+}
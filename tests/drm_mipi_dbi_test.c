@@ -0,0 +1,367 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * KUnit tests of the MIPI DBI SPI transfers against a software SPI
+ * controller that logs every transfer with its D/C level and a timestamp.
+ */
+
+#include <kunit/test.h>
+#include <linux/device.h>
+#include <linux/gpio/driver.h>
+#include <linux/gpio/machine.h>
+#include <linux/ktime.h>
+#include <linux/module.h>
+#include <linux/spi/spi.h>
+#include <video/mipi_display.h>
+
+#include "../drm_mipi_dbi.h"
+
+#define DBI_TEST_MAX_CHUNK 64U
+#define DBI_TEST_MAX_LOG 64
+#define DBI_TEST_DATA_SIZE 1024
+
+struct dbi_test_xfer {
+	unsigned int msg; // sequence number of the message
+	unsigned int len;
+	u8 bpw;
+	int dc;
+	ktime_t ts;
+};
+
+struct dbi_test {
+	struct device *parent;
+	struct spi_controller *ctlr;
+	struct spi_device *spi;
+	struct gpio_chip chip;
+	struct gpio_desc *dc_gpio;
+	struct mipi_dbi dbi;
+
+	int dc; // level of the D/C line
+	bool stall; // hold on to the next message
+	struct spi_message *held;
+
+	unsigned int msgs;
+	unsigned int nr;
+	struct dbi_test_xfer log[DBI_TEST_MAX_LOG];
+	size_t data_len;
+	u8 data[DBI_TEST_DATA_SIZE]; // D/C high bytes in bus order
+
+	struct mipi_dbi_async async;
+	unsigned int completions;
+};
+
+static void dbi_test_gpio_set(struct gpio_chip *chip, unsigned int offset,
+			      int value)
+{
+	struct dbi_test *t = gpiochip_get_data(chip);
+
+	t->dc = value;
+}
+
+static int dbi_test_gpio_get(struct gpio_chip *chip, unsigned int offset)
+{
+	struct dbi_test *t = gpiochip_get_data(chip);
+
+	return t->dc;
+}
+
+static int dbi_test_gpio_direction_output(struct gpio_chip *chip,
+					  unsigned int offset, int value)
+{
+	dbi_test_gpio_set(chip, offset, value);
+
+	return 0;
+}
+
+static void dbi_test_log_message(struct dbi_test *t, struct spi_message *m)
+{
+	struct spi_transfer *tr;
+
+	list_for_each_entry(tr, &m->transfers, transfer_list) {
+		if (t->nr < DBI_TEST_MAX_LOG)
+			t->log[t->nr++] = (struct dbi_test_xfer) {
+				.msg = t->msgs,
+				.len = tr->len,
+				.bpw = tr->bits_per_word,
+				.dc = t->dc,
+				.ts = ktime_get(),
+			};
+
+		if (t->dc && t->data_len + tr->len <= DBI_TEST_DATA_SIZE) {
+			memcpy(t->data + t->data_len, tr->tx_buf, tr->len);
+			t->data_len += tr->len;
+		}
+		m->actual_length += tr->len;
+	}
+	t->msgs++;
+	m->status = 0;
+}
+
+static int dbi_test_transfer_one_message(struct spi_controller *ctlr,
+					 struct spi_message *m)
+{
+	struct dbi_test *t = *(struct dbi_test **)spi_controller_get_devdata(ctlr);
+
+	if (t->stall) {
+		t->held = m;
+		return 0;
+	}
+
+	dbi_test_log_message(t, m);
+	spi_finalize_current_message(ctlr);
+
+	return 0;
+}
+
+/* Let a message held back by @stall go through */
+static void dbi_test_release(struct dbi_test *t)
+{
+	t->stall = false;
+	if (!t->held)
+		return;
+
+	dbi_test_log_message(t, t->held);
+	t->held = NULL;
+	spi_finalize_current_message(t->ctlr);
+}
+
+static size_t dbi_test_max_transfer_size(struct spi_device *spi)
+{
+	return DBI_TEST_MAX_CHUNK;
+}
+
+static void dbi_test_async_complete(struct mipi_dbi_async *async)
+{
+	struct dbi_test *t = container_of(async, struct dbi_test, async);
+
+	t->completions++;
+}
+
+static int dbi_test_init(struct kunit *test)
+{
+	struct spi_board_info info = {
+		.modalias = "mipi-dbi-test",
+		.max_speed_hz = 1000000,
+	};
+	struct dbi_test *t;
+	int ret;
+
+	t = kunit_kzalloc(test, sizeof(*t), GFP_KERNEL);
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, t);
+	test->priv = t;
+
+	t->parent = root_device_register("mipi-dbi-test");
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, t->parent);
+
+	t->chip.label = "mipi-dbi-test-dc";
+	t->chip.parent = t->parent;
+	t->chip.owner = THIS_MODULE;
+	t->chip.base = -1;
+	t->chip.ngpio = 1;
+	t->chip.get = dbi_test_gpio_get;
+	t->chip.set = dbi_test_gpio_set;
+	t->chip.direction_output = dbi_test_gpio_direction_output;
+	ret = gpiochip_add_data(&t->chip, t);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	t->dc_gpio = gpiochip_request_own_desc(&t->chip, 0, "dc",
+					       GPIO_ACTIVE_HIGH,
+					       GPIOD_OUT_LOW);
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, t->dc_gpio);
+
+	t->ctlr = spi_alloc_master(t->parent, sizeof(t));
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, t->ctlr);
+	*(struct dbi_test **)spi_controller_get_devdata(t->ctlr) = t;
+	t->ctlr->bus_num = -1;
+	t->ctlr->num_chipselect = 1;
+	t->ctlr->bits_per_word_mask = SPI_BPW_MASK(8) | SPI_BPW_MASK(16);
+	t->ctlr->transfer_one_message = dbi_test_transfer_one_message;
+	t->ctlr->max_transfer_size = dbi_test_max_transfer_size;
+	ret = spi_register_controller(t->ctlr);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	t->spi = spi_new_device(t->ctlr, &info);
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, t->spi);
+
+	ret = mipi_dbi_spi_init(t->spi, &t->dbi, t->dc_gpio);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	t->async.complete = dbi_test_async_complete;
+
+	return 0;
+}
+
+static void dbi_test_exit(struct kunit *test)
+{
+	struct dbi_test *t = test->priv;
+
+	if (!t)
+		return;
+
+	dbi_test_release(t);
+	if (t->spi) {
+		mipi_dbi_async_wait(&t->dbi);
+		spi_unregister_device(t->spi);
+	}
+	if (t->ctlr)
+		spi_unregister_controller(t->ctlr);
+	if (!IS_ERR_OR_NULL(t->dc_gpio))
+		gpiochip_free_own_desc(t->dc_gpio);
+	if (t->chip.gpiodev)
+		gpiochip_remove(&t->chip);
+	if (!IS_ERR_OR_NULL(t->parent))
+		root_device_unregister(t->parent);
+}
+
+static void dbi_test_fill(u8 *buf, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		buf[i] = i * 7 + 3;
+}
+
+/* Command byte with D/C low, parameters with D/C high */
+static void dbi_test_command(struct kunit *test)
+{
+	struct dbi_test *t = test->priv;
+	int ret;
+
+	ret = mipi_dbi_command(&t->dbi, MIPI_DCS_SET_COLUMN_ADDRESS, 0x12, 0x34);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	KUNIT_ASSERT_EQ(test, t->nr, 2U);
+	KUNIT_EXPECT_EQ(test, t->log[0].len, 1U);
+	KUNIT_EXPECT_EQ(test, t->log[0].dc, 0);
+	KUNIT_EXPECT_EQ(test, t->log[1].len, 2U);
+	KUNIT_EXPECT_EQ(test, t->log[1].dc, 1);
+	KUNIT_EXPECT_EQ(test, t->log[1].bpw, (u8)8);
+	KUNIT_EXPECT_EQ(test, t->data[0], (u8)0x12);
+	KUNIT_EXPECT_EQ(test, t->data[1], (u8)0x34);
+}
+
+/*
+ * A synchronous write is split into chunks the controller can take and
+ * up to MIPI_DBI_SPI_MAX_XFERS of them go out as one message.
+ */
+static void dbi_test_sync_chain(struct kunit *test)
+{
+	struct dbi_test *t = test->priv;
+	size_t len = 1000, total = 0;
+	u8 *buf;
+	unsigned int i, per_msg = 0;
+	int ret;
+
+	buf = kunit_kmalloc(test, len, GFP_KERNEL);
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, buf);
+	dbi_test_fill(buf, len);
+
+	ret = mipi_dbi_command_buf(&t->dbi, MIPI_DCS_WRITE_MEMORY_START, buf,
+				   len);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	/* command, then DIV_ROUND_UP(1000, 4 * 64) data messages */
+	KUNIT_EXPECT_EQ(test, t->msgs, 5U);
+	for (i = 1; i < t->nr; i++) {
+		KUNIT_EXPECT_EQ(test, t->log[i].dc, 1);
+		KUNIT_EXPECT_EQ(test, t->log[i].bpw, (u8)16);
+		KUNIT_EXPECT_LE(test, t->log[i].len, DBI_TEST_MAX_CHUNK);
+		KUNIT_EXPECT_TRUE(test, ktime_compare(t->log[i].ts,
+						      t->log[i - 1].ts) >= 0);
+
+		per_msg = t->log[i].msg == t->log[i - 1].msg ? per_msg + 1 : 1;
+		KUNIT_EXPECT_LE(test, per_msg,
+				(unsigned int)MIPI_DBI_SPI_MAX_XFERS);
+		total += t->log[i].len;
+	}
+	KUNIT_EXPECT_EQ(test, total, len);
+	KUNIT_ASSERT_EQ(test, t->data_len, len);
+	KUNIT_EXPECT_EQ(test, memcmp(t->data, buf, len), 0);
+}
+
+/* The data of an asynchronous write is chained into a single message */
+static void dbi_test_async_chain(struct kunit *test)
+{
+	struct dbi_test *t = test->priv;
+	size_t len = 4 * DBI_TEST_MAX_CHUNK - 8;
+	unsigned int i;
+	u8 *buf;
+	int ret;
+
+	buf = kunit_kmalloc(test, len, GFP_KERNEL);
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, buf);
+	dbi_test_fill(buf, len);
+
+	ret = mipi_dbi_command_buf_async(&t->dbi, MIPI_DCS_WRITE_MEMORY_START,
+					 buf, len, &t->async);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+	KUNIT_ASSERT_EQ(test, mipi_dbi_async_wait(&t->dbi), 0);
+
+	KUNIT_EXPECT_EQ(test, t->completions, 1U);
+	KUNIT_EXPECT_EQ(test, t->async.status, 0);
+	KUNIT_EXPECT_EQ(test, t->async.len, len);
+
+	KUNIT_ASSERT_EQ(test, t->nr, 5U);
+	KUNIT_EXPECT_EQ(test, t->log[0].dc, 0);
+	for (i = 1; i < t->nr; i++) {
+		KUNIT_EXPECT_EQ(test, t->log[i].msg, 1U);
+		KUNIT_EXPECT_EQ(test, t->log[i].dc, 1);
+	}
+	KUNIT_EXPECT_EQ(test, t->log[4].len, DBI_TEST_MAX_CHUNK - 8);
+	KUNIT_ASSERT_EQ(test, t->data_len, len);
+	KUNIT_EXPECT_EQ(test, memcmp(t->data, buf, len), 0);
+}
+
+/* A write that never completes times out and stays pending */
+static void dbi_test_async_timeout(struct kunit *test)
+{
+	struct dbi_test *t = test->priv;
+	size_t len = 2 * DBI_TEST_MAX_CHUNK;
+	u8 *buf;
+	int ret;
+
+	buf = kunit_kmalloc(test, len, GFP_KERNEL);
+	KUNIT_ASSERT_NOT_ERR_OR_NULL(test, buf);
+	dbi_test_fill(buf, len);
+
+	ret = mipi_dbi_command(&t->dbi, MIPI_DCS_NOP);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	t->stall = true;
+	ret = mipi_dbi_command_buf_async(&t->dbi, MIPI_DCS_WRITE_MEMORY_START,
+					 buf, len, &t->async);
+	KUNIT_ASSERT_EQ(test, ret, 0);
+
+	KUNIT_EXPECT_EQ(test, mipi_dbi_async_wait(&t->dbi), -ETIMEDOUT);
+	KUNIT_EXPECT_EQ(test, t->async.status, -ETIMEDOUT);
+	KUNIT_EXPECT_EQ(test, t->completions, 0U);
+
+	/* the D/C line must not be touched while the write is stuck */
+	KUNIT_EXPECT_EQ(test, mipi_dbi_command(&t->dbi, MIPI_DCS_NOP),
+			-ETIMEDOUT);
+	KUNIT_EXPECT_EQ(test, t->dc, 1);
+
+	dbi_test_release(t);
+	KUNIT_EXPECT_EQ(test, mipi_dbi_async_wait(&t->dbi), 0);
+	KUNIT_EXPECT_EQ(test, t->async.status, 0);
+	KUNIT_EXPECT_EQ(test, t->completions, 1U);
+	KUNIT_EXPECT_EQ(test, t->data_len, len);
+}
+
+static struct kunit_case mipi_dbi_test_cases[] = {
+	KUNIT_CASE(dbi_test_command),
+	KUNIT_CASE(dbi_test_sync_chain),
+	KUNIT_CASE(dbi_test_async_chain),
+	KUNIT_CASE(dbi_test_async_timeout),
+	{}
+};
+
+static struct kunit_suite mipi_dbi_test_suite = {
+	.name = "st7305-mipi-dbi",
+	.init = dbi_test_init,
+	.exit = dbi_test_exit,
+	.test_cases = mipi_dbi_test_cases,
+};
+
+kunit_test_suite(mipi_dbi_test_suite);
+
+MODULE_LICENSE("GPL");
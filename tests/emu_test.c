@@ -0,0 +1,338 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Golden image test of the panel emulator: damage on a framebuffer goes
+ * through the driver's flush path, st7305-flush.c for the damage, windows
+ * and runs and st7305-convert.c for the rotation and conversion, the runs
+ * are sent to st7305_emu_command() the way the flush worker does and the
+ * rendered PBM is compared pixel for pixel with the framebuffer. Every
+ * flush has to show up as one emulator frame.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+#include <drm/drm_fourcc.h>
+#include <video/mipi_display.h>
+
+#include "dither.h"
+#include "geometry.h"
+#include "../st7305-convert.h"
+#include "../st7305-emu.h"
+#include "../st7305-flush.h"
+
+#define ITERATIONS 50
+#define MAX_RECTS 6
+
+static const unsigned int rotations[] = { 0, 90, 180, 270 };
+static const u32 formats[] = {
+	DRM_FORMAT_XRGB8888, DRM_FORMAT_R8, DRM_FORMAT_R1,
+};
+
+struct emu_test {
+	const struct st7305_panel *g;
+	uint width, height; // of the framebuffer
+	struct st7305_emu emu;
+	struct st7305_flush flush;
+	struct st7305_convert conv;
+	struct st7305_src src;
+	u8 *image; // framebuffer as gray, 0x00 or 0xff
+	u8 *tx; // converted frame, like tx_buf
+	u8 *win; // runs back to back, like win_buf
+	u8 *pbm;
+	char name[64];
+	struct st7305_emu_count sent; // since the last flush
+};
+
+static void send(struct emu_test *t, u8 cmd, const u8 *data, size_t len)
+{
+	st7305_emu_command(&t->emu, cmd, data, len);
+
+	t->sent.commands++;
+	t->sent.transfers += len ? 2 : 1;
+	t->sent.bytes += 1 + len;
+	if (cmd == MIPI_DCS_WRITE_MEMORY_START)
+		t->sent.ram_bytes += len;
+}
+
+static void send_cmd(struct emu_test *t, u8 cmd)
+{
+	send(t, cmd, NULL, 0);
+}
+
+static void send_pair(struct emu_test *t, u8 cmd, u8 a, u8 b)
+{
+	u8 data[2] = { a, b };
+
+	send(t, cmd, data, sizeof(data));
+}
+
+static void write_pbm(struct emu_test *t, const char *what)
+{
+	char name[128];
+	size_t len;
+	FILE *fp;
+
+	len = st7305_emu_render_pbm(&t->emu, t->pbm);
+	snprintf(name, sizeof(name), "emu_test-%s-%s.pbm", t->name, what);
+	fp = fopen(name, "wb");
+	if (!fp)
+		return;
+	fwrite(t->pbm, 1, len, fp);
+	fclose(fp);
+	fprintf(stderr, "%s: wrote %s\n", t->name, name);
+}
+
+/*
+ * st7305_fb_dirty() and st7305_flush_worker(): convert the damage, collect
+ * the runs and send them. Returns the number of runs, or -1 if the frame
+ * the emulator counted is not the whole flush.
+ */
+static int flush(struct emu_test *t)
+{
+	const struct st7305_panel *g = t->g;
+	struct st7305_run runs[ST7305_MAX_RUNS];
+	u64 convert_ns = 0, pack_ns = 0;
+	struct drm_rect *rect, win;
+	size_t skipped = 0, width, len;
+	u8 *tr = t->win;
+	int i, nr;
+
+	for (i = 0; i < t->flush.damage_nr; i++) {
+		rect = &t->flush.damage[i];
+		st7305_damage_to_window(&t->flush, rect, &win);
+		st7305_fb_to_mono(&t->conv, t->tx, &t->src, rect,
+				  DITHER_TYPE_NONE, false, &convert_ns,
+				  &pack_ns);
+		st7305_add_window(&t->flush, &win);
+	}
+	t->flush.damage_nr = 0;
+
+	nr = st7305_flush_runs(&t->flush, t->tx, runs, t->win, &skipped);
+
+	for (i = 0; i < nr; i++) {
+		width = (runs[i].x2 - runs[i].x1) * ST7305_COL_BYTES;
+		len = width * (runs[i].last - runs[i].first + 1);
+
+		if (!i || runs[i].x1 != runs[i - 1].x1 ||
+		    runs[i].x2 != runs[i - 1].x2)
+			send_pair(t, MIPI_DCS_SET_COLUMN_ADDRESS,
+				  g->caset[0] + runs[i].x1,
+				  g->caset[0] + runs[i].x2 - 1);
+		send_pair(t, MIPI_DCS_SET_PAGE_ADDRESS,
+			  g->raset[0] + runs[i].first,
+			  g->raset[0] + runs[i].last);
+		send(t, MIPI_DCS_WRITE_MEMORY_START, tr, len);
+		tr += len;
+	}
+
+	if (!nr)
+		return 0;
+
+	st7305_emu_frame_end(&t->emu);
+	if (memcmp(&t->emu.last_frame, &t->sent, sizeof(t->sent)) ||
+	    t->emu.last_frame.ram_bytes != tr - t->win) {
+		fprintf(stderr,
+			"%s: flush of %d runs: frame commands=%llu transfers=%llu bytes=%llu ram_bytes=%llu, sent commands=%llu ram_bytes=%zu\n",
+			t->name, nr, t->emu.last_frame.commands,
+			t->emu.last_frame.transfers, t->emu.last_frame.bytes,
+			t->emu.last_frame.ram_bytes, t->sent.commands,
+			(size_t)(tr - t->win));
+		return -1;
+	}
+	memset(&t->sent, 0, sizeof(t->sent));
+
+	return nr;
+}
+
+/* Framebuffer pixel shown at panel pixel @x, @y, see st7305_src_line() */
+static u8 fb_pixel(const struct emu_test *t, uint x, uint y)
+{
+	const struct st7305_panel *g = t->g;
+	uint fx = x, fy = y;
+
+	switch (t->src.rotation) {
+	case 90:
+		fx = g->height - 1 - y;
+		fy = x;
+		break;
+	case 180:
+		fx = g->width - 1 - x;
+		fy = g->height - 1 - y;
+		break;
+	case 270:
+		fx = y;
+		fy = g->width - 1 - x;
+		break;
+	}
+
+	return t->image[fy * t->width + fx];
+}
+
+/* Compare the glass against the framebuffer, or all black if @blank */
+static int compare(struct emu_test *t, bool blank, const char *what)
+{
+	const struct st7305_panel *g = t->g;
+	uint pitch = DIV_ROUND_UP(g->width, 8);
+	size_t len = st7305_emu_render_pbm(&t->emu, t->pbm);
+	size_t hdr = len - pitch * g->height;
+	uint x, y;
+
+	if (len > st7305_emu_pbm_size(&t->emu) ||
+	    memcmp(t->pbm, "P4\n", 3)) {
+		fprintf(stderr, "%s: %s: bad PBM of %zu bytes\n", t->name,
+			what, len);
+		return 1;
+	}
+
+	for (y = 0; y < g->height; y++) {
+		for (x = 0; x < g->width; x++) {
+			bool black = t->pbm[hdr + y * pitch + x / 8] &
+				     BIT(7 - x % 8);
+			bool want = blank || !fb_pixel(t, x, y);
+
+			if (black == want)
+				continue;
+			fprintf(stderr, "%s: %s: pixel %u,%u is %s\n", t->name,
+				what, x, y, black ? "black" : "white");
+			write_pbm(t, "fail");
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* Draw into @r of the framebuffer and report it as damage */
+static void damage(struct emu_test *t, const struct drm_rect *r)
+{
+	int x, y;
+
+	/* blocks and noise, a shifted clip shows up as broken edges */
+	for (y = r->y1; y < r->y2; y++)
+		for (x = r->x1; x < r->x2; x++)
+			t->image[y * t->width + x] =
+				(rand() % 4 ? (x / 5 + y / 3) & 1 :
+					      rand() & 1) * 0xff;
+
+	st7305_add_damage(&t->flush, r);
+}
+
+/* Unaligned framebuffer rect like the damage of a plane update */
+static void random_rect(const struct emu_test *t, struct drm_rect *r)
+{
+	r->x1 = rand() % t->width;
+	r->x2 = r->x1 + 1 + rand() % (t->width - r->x1);
+	r->y1 = rand() % t->height;
+	r->y2 = r->y1 + 1 + rand() % (t->height - r->y1);
+
+	/* mostly small rects, so that the windows stay apart */
+	if (rand() % 4) {
+		r->x2 = min_t(int, r->x2, r->x1 + 1 + rand() % 40);
+		r->y2 = min_t(int, r->y2, r->y1 + 1 + rand() % 40);
+	}
+}
+
+static int check(const struct st7305_panel *g, unsigned int rotation,
+		 u32 format)
+{
+	struct emu_test t = { .g = g };
+	struct drm_rect r, rects[MAX_RECTS];
+	int ret, i, j, n;
+
+	t.width = g->width;
+	t.height = g->height;
+	if (rotation == 90 || rotation == 270)
+		swap(t.width, t.height);
+	snprintf(t.name, sizeof(t.name), "%s-%u-%.2s", g->name, rotation,
+		 (const char *)&format);
+
+	ret = st7305_emu_init(NULL, &t.emu, g) ?:
+	      st7305_flush_init(NULL, &t.flush, g, rotation) ?:
+	      st7305_convert_init(NULL, &t.conv, g);
+	if (ret)
+		return 1;
+
+	t.image = calloc(1, t.width * t.height);
+	t.tx = calloc(1, st7305_panel_bufsize(g));
+	t.win = malloc(st7305_panel_bufsize(g));
+	t.pbm = malloc(st7305_emu_pbm_size(&t.emu));
+	t.src.vaddr = malloc(t.width * t.height * 4);
+	t.src.format = format;
+	t.src.rotation = rotation;
+
+	/* the first enable sends the whole RAM */
+	r = (struct drm_rect){ 0, 0, t.width, t.height };
+	damage(&t, &r);
+	t.src.pitch = st7305_bench_format(t.src.vaddr, t.image, t.width,
+					  t.height, format);
+	st7305_flush_all(&t.flush);
+	ret = flush(&t) < 0;
+
+	/* the glass stays black until the panel is awake and on */
+	ret = ret ?: compare(&t, true, "asleep");
+	send_cmd(&t, MIPI_DCS_EXIT_SLEEP_MODE);
+	send_cmd(&t, MIPI_DCS_ENTER_INVERT_MODE);
+	ret = ret ?: compare(&t, true, "display off");
+	send_cmd(&t, MIPI_DCS_SET_DISPLAY_ON);
+	ret = ret ?: compare(&t, false, "full frame");
+
+	for (i = 0; i < ITERATIONS && !ret; i++) {
+		/* several clips of one plane update */
+		n = 1 + rand() % MAX_RECTS;
+		for (j = 0; j < n; j++) {
+			random_rect(&t, &rects[j]);
+			damage(&t, &rects[j]);
+		}
+		t.src.pitch = st7305_bench_format(t.src.vaddr, t.image,
+						  t.width, t.height, format);
+		/* write-combined framebuffers go through the bounce buffer */
+		t.src.bounce = i & 1;
+		ret = flush(&t) < 0;
+		ret = ret ?: compare(&t, false, "partial update");
+
+		/* the shadow catches damage without a change */
+		for (j = 0; j < n && !ret; j++)
+			st7305_add_damage(&t.flush, &rects[j]);
+		if (!ret && flush(&t)) {
+			fprintf(stderr, "%s: unchanged damage was sent\n",
+				t.name);
+			ret = 1;
+		}
+	}
+
+	send_cmd(&t, MIPI_DCS_ENTER_SLEEP_MODE);
+	ret = ret ?: compare(&t, true, "sleep");
+
+	if (ret)
+		printf("emu %s: FAIL\n", t.name);
+
+	free(t.src.vaddr);
+	free(t.pbm);
+	free(t.win);
+	free(t.tx);
+	free(t.image);
+
+	return ret;
+}
+
+int main(void)
+{
+	uint i, r, f;
+	int ret = 0, fail;
+
+	srand(1);
+
+	for (i = 0; i < ARRAY_SIZE(panels); i++) {
+		fail = 0;
+		for (r = 0; r < ARRAY_SIZE(rotations); r++)
+			for (f = 0; f < ARRAY_SIZE(formats); f++)
+				fail |= check(panels[i], rotations[r],
+					      formats[f]);
+		printf("emu %s: %s\n", panels[i]->name, fail ? "FAIL" : "ok");
+		ret |= fail;
+	}
+
+	return ret;
+}
@@ -0,0 +1,41 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+/*
+ * The panels of st7305-panel.c for the host programs, which link it in.
+ */
+#ifndef __TESTS_GEOMETRY_H
+#define __TESTS_GEOMETRY_H
+
+#include <stdlib.h>
+
+#include <linux/kernel.h>
+
+#include <drm/drm_rect.h>
+
+#include "st7305-pack.h"
+#include "st7305-panel.h"
+
+static const struct st7305_panel *const panels[] = {
+	&ydp154h008_v3_panel,
+	&ydp213h001_v3_panel,
+	&ydp290h001_v3_panel,
+	&w420hc018mono_12z_panel,
+	&ydp420h001_v3_panel,
+};
+
+/* A random clip of @panel, aligned by the driver. False if it is empty. */
+static inline bool random_clip(const struct st7305_panel *panel,
+			       struct drm_rect *clip)
+{
+	clip->x1 = rand() % panel->width;
+	clip->x2 = rand() % panel->width + 1;
+	clip->y1 = rand() % panel->height;
+	clip->y2 = rand() % panel->height + 1;
+	if (clip->x1 >= clip->x2 || clip->y1 >= clip->y2)
+		return false;
+
+	st7305_align_clip(panel, clip);
+
+	return true;
+}
+
+#endif /* __TESTS_GEOMETRY_H */
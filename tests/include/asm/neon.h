@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_ASM_NEON_H
+#define __HOST_ASM_NEON_H
+
+/* User space may always use NEON */
+static inline void kernel_neon_begin(void) {}
+static inline void kernel_neon_end(void) {}
+
+#endif /* __HOST_ASM_NEON_H */
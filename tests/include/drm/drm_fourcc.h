@@ -0,0 +1,14 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_DRM_FOURCC_H
+#define __HOST_DRM_FOURCC_H
+
+#include <linux/types.h>
+
+#define fourcc_code(a, b, c, d) ((u32)(a) | ((u32)(b) << 8) | \
+				 ((u32)(c) << 16) | ((u32)(d) << 24))
+
+#define DRM_FORMAT_R1 fourcc_code('R', '1', ' ', ' ')
+#define DRM_FORMAT_R8 fourcc_code('R', '8', ' ', ' ')
+#define DRM_FORMAT_XRGB8888 fourcc_code('X', 'R', '2', '4')
+
+#endif /* __HOST_DRM_FOURCC_H */
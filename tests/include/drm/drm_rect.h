@@ -0,0 +1,41 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_DRM_RECT_H
+#define __HOST_DRM_RECT_H
+
+#include <linux/kernel.h>
+
+struct drm_rect {
+	int x1, y1, x2, y2;
+};
+
+#define DRM_RECT_FMT "%dx%d%+d%+d"
+#define DRM_RECT_ARG(r) drm_rect_width(r), drm_rect_height(r), (r)->x1, (r)->y1
+
+static inline int drm_rect_width(const struct drm_rect *r)
+{
+	return r->x2 - r->x1;
+}
+
+static inline int drm_rect_height(const struct drm_rect *r)
+{
+	return r->y2 - r->y1;
+}
+
+static inline bool drm_rect_visible(const struct drm_rect *r)
+{
+	return drm_rect_width(r) > 0 && drm_rect_height(r) > 0;
+}
+
+/* Clips @r1 to @r2, returns whether anything is left */
+static inline bool drm_rect_intersect(struct drm_rect *r1,
+				      const struct drm_rect *r2)
+{
+	r1->x1 = max(r1->x1, r2->x1);
+	r1->y1 = max(r1->y1, r2->y1);
+	r1->x2 = min(r1->x2, r2->x2);
+	r1->y2 = min(r1->y2, r2->y2);
+
+	return drm_rect_visible(r1);
+}
+
+#endif /* __HOST_DRM_RECT_H */
@@ -0,0 +1,16 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_DEVICE_H
+#define __HOST_LINUX_DEVICE_H
+
+#include <stdlib.h>
+
+#include <linux/slab.h>
+
+/* Device managed allocations are simply leaked by the host programs */
+struct device;
+
+#define devm_kcalloc(dev, n, size, gfp) calloc(n, size)
+#define devm_kmalloc(dev, size, gfp) malloc(size)
+#define devm_kzalloc(dev, size, gfp) calloc(1, size)
+
+#endif /* __HOST_LINUX_DEVICE_H */
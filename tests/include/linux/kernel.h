@@ -0,0 +1,50 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_KERNEL_H
+#define __HOST_LINUX_KERNEL_H
+
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+
+#include <linux/types.h>
+
+#define BIT(n) (1UL << (n))
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+#define min(a, b) ({ __typeof__(a) _a = (a); __typeof__(b) _b = (b); \
+		     _a < _b ? _a : _b; })
+#define max(a, b) ({ __typeof__(a) _a = (a); __typeof__(b) _b = (b); \
+		     _a > _b ? _a : _b; })
+#define min3(a, b, c) min(min(a, b), c)
+#define min_t(t, a, b) min((t)(a), (t)(b))
+#define max_t(t, a, b) max((t)(a), (t)(b))
+#define clamp_t(t, v, lo, hi) min_t(t, max_t(t, v, lo), hi)
+#define swap(a, b) do { __typeof__(a) _t = (a); (a) = (b); (b) = _t; } while (0)
+
+#define DIV_ROUND_UP(n, d) (((n) + (d) - 1) / (d))
+#define IS_ALIGNED(x, a) (((x) & ((__typeof__(x))(a) - 1)) == 0)
+#define round_down(x, y) ((x) & ~((__typeof__(x))((y) - 1)))
+#define round_up(x, y) ((((x) - 1) | ((__typeof__(x))((y) - 1))) + 1)
+#define rounddown(x, y) ((x) - ((x) % (y)))
+#define roundup(x, y) ((((x) + ((y) - 1)) / (y)) * (y))
+
+#ifndef __always_inline
+#define __always_inline inline __attribute__((__always_inline__))
+#endif
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+#define EXPORT_SYMBOL(sym)
+
+#define fallthrough __attribute__((__fallthrough__))
+#define scnprintf(buf, size, ...) \
+	min_t(int, snprintf(buf, size, __VA_ARGS__), (size) - 1)
+
+#define WARN_ON_ONCE(cond) ({						\
+	int _c = !!(cond);						\
+	if (_c)								\
+		fprintf(stderr, "WARNING: %s:%d\n", __FILE__, __LINE__);	\
+	_c;								\
+})
+
+#endif /* __HOST_LINUX_KERNEL_H */
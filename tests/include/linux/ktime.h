@@ -0,0 +1,25 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_KTIME_H
+#define __HOST_LINUX_KTIME_H
+
+#include <time.h>
+
+#include <linux/types.h>
+
+#define NSEC_PER_SEC 1000000000LL
+#define NSEC_PER_MSEC 1000000LL
+
+typedef s64 ktime_t;
+
+static inline ktime_t ktime_get(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+#define ktime_sub(a, b) ((a) - (b))
+#define ktime_to_ns(kt) (kt)
+
+#endif /* __HOST_LINUX_KTIME_H */
@@ -0,0 +1,14 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_MUTEX_H
+#define __HOST_LINUX_MUTEX_H
+
+/* The host programs are single threaded */
+struct mutex {
+	int locked;
+};
+
+#define mutex_init(m) ((m)->locked = 0)
+#define mutex_lock(m) ((m)->locked++)
+#define mutex_unlock(m) ((m)->locked--)
+
+#endif /* __HOST_LINUX_MUTEX_H */
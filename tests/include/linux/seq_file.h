@@ -0,0 +1,14 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_SEQ_FILE_H
+#define __HOST_LINUX_SEQ_FILE_H
+
+#include <stdio.h>
+
+/* seq_file output goes to a stdio stream */
+struct seq_file {
+	FILE *fp;
+};
+
+#define seq_printf(m, ...) fprintf((m)->fp, __VA_ARGS__)
+
+#endif /* __HOST_LINUX_SEQ_FILE_H */
@@ -0,0 +1,13 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_SLAB_H
+#define __HOST_LINUX_SLAB_H
+
+#include <stdlib.h>
+
+#define GFP_KERNEL 0
+
+#define kcalloc(n, size, gfp) calloc(n, size)
+#define kzalloc(size, gfp) calloc(1, size)
+#define kfree(p) free(p)
+
+#endif /* __HOST_LINUX_SLAB_H */
@@ -0,0 +1,7 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_STRING_H
+#define __HOST_LINUX_STRING_H
+
+#include <string.h>
+
+#endif /* __HOST_LINUX_STRING_H */
@@ -0,0 +1,15 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_LINUX_TRACEPOINT_H
+#define __HOST_LINUX_TRACEPOINT_H
+
+/* Trace events compile to empty trace_<name>() calls */
+#define TP_PROTO(args...) args
+#define TP_ARGS(args...) args
+
+#define DECLARE_EVENT_CLASS(name, proto, args, tstruct, assign, print)
+#define DEFINE_EVENT(template, name, proto, args) \
+	static inline void trace_##name(proto) {}
+#define TRACE_EVENT(name, proto, args, tstruct, assign, print) \
+	static inline void trace_##name(proto) {}
+
+#endif /* __HOST_LINUX_TRACEPOINT_H */
@@ -0,0 +1,23 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+/*
+ * Host stand-ins for the kernel headers the conversion code uses, just
+ * enough to build it into the programs under tests/ and bench/.
+ */
+#ifndef __HOST_LINUX_TYPES_H
+#define __HOST_LINUX_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef unsigned long long u64; // %llu, as in the kernel
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef long long s64;
+
+#endif /* __HOST_LINUX_TYPES_H */
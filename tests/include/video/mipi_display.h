@@ -0,0 +1,22 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+#ifndef __HOST_VIDEO_MIPI_DISPLAY_H
+#define __HOST_VIDEO_MIPI_DISPLAY_H
+
+/* The DCS commands the driver sends, values from the MIPI DCS spec */
+enum {
+	MIPI_DCS_NOP = 0x00,
+	MIPI_DCS_ENTER_SLEEP_MODE = 0x10,
+	MIPI_DCS_EXIT_SLEEP_MODE = 0x11,
+	MIPI_DCS_EXIT_INVERT_MODE = 0x20,
+	MIPI_DCS_ENTER_INVERT_MODE = 0x21,
+	MIPI_DCS_SET_DISPLAY_OFF = 0x28,
+	MIPI_DCS_SET_DISPLAY_ON = 0x29,
+	MIPI_DCS_SET_COLUMN_ADDRESS = 0x2A,
+	MIPI_DCS_SET_PAGE_ADDRESS = 0x2B,
+	MIPI_DCS_WRITE_MEMORY_START = 0x2C,
+	MIPI_DCS_SET_ADDRESS_MODE = 0x36,
+	MIPI_DCS_SET_PIXEL_FORMAT = 0x3A,
+	MIPI_DCS_WRITE_MEMORY_CONTINUE = 0x3C,
+};
+
+#endif /* __HOST_VIDEO_MIPI_DISPLAY_H */
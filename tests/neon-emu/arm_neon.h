@@ -0,0 +1,192 @@
+/* SPDX-License-Identifier: GPL-2.0+ */
+/*
+ * Plain C versions of the NEON intrinsics st7305-neon.c uses, lane by lane
+ * as the ARM reference describes them. Lets neon_test cross-check the
+ * vector code against the scalar one on hosts without NEON or an ARM
+ * emulator. Only included when the host compiler is not targeting ARM.
+ */
+#ifndef __NEON_EMU_ARM_NEON_H
+#define __NEON_EMU_ARM_NEON_H
+
+#include <stdint.h>
+
+typedef struct { uint8_t v[8]; } uint8x8_t;
+typedef struct { uint8_t v[16]; } uint8x16_t;
+typedef struct { int8_t v[16]; } int8x16_t;
+typedef struct { uint16_t v[4]; } uint16x4_t;
+typedef struct { uint16_t v[8]; } uint16x8_t;
+typedef struct { uint32_t v[4]; } uint32x4_t;
+typedef struct { uint8x16_t val[4]; } uint8x16x4_t;
+
+#define NEON_EMU_MAP(type, n, expr) ({		\
+	type _r;				\
+	int i;					\
+	for (i = 0; i < (n); i++)		\
+		_r.v[i] = (expr);		\
+	_r;					\
+})
+
+/* Loads, stores and lane moves */
+static inline uint8x16_t vld1q_u8(const uint8_t *p)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, p[i]);
+}
+
+static inline int8x16_t vld1q_s8(const int8_t *p)
+{
+	return NEON_EMU_MAP(int8x16_t, 16, p[i]);
+}
+
+static inline uint8x16x4_t vld4q_u8(const uint8_t *p)
+{
+	uint8x16x4_t r;
+	int i, j;
+
+	for (i = 0; i < 16; i++)
+		for (j = 0; j < 4; j++)
+			r.val[j].v[i] = p[4 * i + j];
+	return r;
+}
+
+static inline void vst1q_u8(uint8_t *p, uint8x16_t a)
+{
+	int i;
+
+	for (i = 0; i < 16; i++)
+		p[i] = a.v[i];
+}
+
+static inline void vst1_u8(uint8_t *p, uint8x8_t a)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+		p[i] = a.v[i];
+}
+
+static inline uint8x16_t vdupq_n_u8(uint8_t x)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, x);
+}
+
+static inline uint8x8_t vdup_n_u8(uint8_t x)
+{
+	return NEON_EMU_MAP(uint8x8_t, 8, x);
+}
+
+static inline uint8x8_t vget_low_u8(uint8x16_t a)
+{
+	return NEON_EMU_MAP(uint8x8_t, 8, a.v[i]);
+}
+
+static inline uint8x8_t vget_high_u8(uint8x16_t a)
+{
+	return NEON_EMU_MAP(uint8x8_t, 8, a.v[i + 8]);
+}
+
+static inline uint16x4_t vget_low_u16(uint16x8_t a)
+{
+	return NEON_EMU_MAP(uint16x4_t, 4, a.v[i]);
+}
+
+static inline uint16x4_t vget_high_u16(uint16x8_t a)
+{
+	return NEON_EMU_MAP(uint16x4_t, 4, a.v[i + 4]);
+}
+
+static inline uint8x16_t vcombine_u8(uint8x8_t lo, uint8x8_t hi)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, i < 8 ? lo.v[i] : hi.v[i - 8]);
+}
+
+static inline uint16x8_t vcombine_u16(uint16x4_t lo, uint16x4_t hi)
+{
+	return NEON_EMU_MAP(uint16x8_t, 8, i < 4 ? lo.v[i] : hi.v[i - 4]);
+}
+
+/* Widening and narrowing arithmetic */
+static inline uint16x8_t vmull_u8(uint8x8_t a, uint8x8_t b)
+{
+	return NEON_EMU_MAP(uint16x8_t, 8, (uint16_t)a.v[i] * b.v[i]);
+}
+
+static inline uint16x8_t vmlal_u8(uint16x8_t acc, uint8x8_t a, uint8x8_t b)
+{
+	return NEON_EMU_MAP(uint16x8_t, 8, acc.v[i] + (uint16_t)a.v[i] * b.v[i]);
+}
+
+static inline uint16x8_t vaddw_u8(uint16x8_t a, uint8x8_t b)
+{
+	return NEON_EMU_MAP(uint16x8_t, 8, a.v[i] + b.v[i]);
+}
+
+static inline uint32x4_t vmull_n_u16(uint16x4_t a, uint16_t b)
+{
+	return NEON_EMU_MAP(uint32x4_t, 4, (uint32_t)a.v[i] * b);
+}
+
+static inline uint16x4_t vshrn_n_u32(uint32x4_t a, int n)
+{
+	return NEON_EMU_MAP(uint16x4_t, 4, a.v[i] >> n);
+}
+
+static inline uint8x8_t vmovn_u16(uint16x8_t a)
+{
+	return NEON_EMU_MAP(uint8x8_t, 8, a.v[i]);
+}
+
+static inline uint16x4_t vmovn_u32(uint32x4_t a)
+{
+	return NEON_EMU_MAP(uint16x4_t, 4, a.v[i]);
+}
+
+static inline uint16x8_t vpaddlq_u8(uint8x16_t a)
+{
+	return NEON_EMU_MAP(uint16x8_t, 8, a.v[2 * i] + a.v[2 * i + 1]);
+}
+
+static inline uint32x4_t vpaddlq_u16(uint16x8_t a)
+{
+	return NEON_EMU_MAP(uint32x4_t, 4, a.v[2 * i] + a.v[2 * i + 1]);
+}
+
+/* Logic, compares and shifts */
+static inline uint8x16_t vcgtq_u8(uint8x16_t a, uint8x16_t b)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, a.v[i] > b.v[i] ? 0xff : 0);
+}
+
+static inline uint8x16_t vandq_u8(uint8x16_t a, uint8x16_t b)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, a.v[i] & b.v[i]);
+}
+
+static inline uint8x16_t vorrq_u8(uint8x16_t a, uint8x16_t b)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, a.v[i] | b.v[i]);
+}
+
+static inline uint8x8_t vorr_u8(uint8x8_t a, uint8x8_t b)
+{
+	return NEON_EMU_MAP(uint8x8_t, 8, a.v[i] | b.v[i]);
+}
+
+static inline uint8x16_t vshrq_n_u8(uint8x16_t a, int n)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16, a.v[i] >> n);
+}
+
+static inline uint8x8_t vshr_n_u8(uint8x8_t a, int n)
+{
+	return NEON_EMU_MAP(uint8x8_t, 8, a.v[i] >> n);
+}
+
+/* Shift by a signed per lane amount, negative shifts right */
+static inline uint8x16_t vshlq_u8(uint8x16_t a, int8x16_t b)
+{
+	return NEON_EMU_MAP(uint8x16_t, 16,
+			    b.v[i] >= 0 ? (uint8_t)(a.v[i] << b.v[i]) :
+					  a.v[i] >> -b.v[i]);
+}
+
+#endif /* __NEON_EMU_ARM_NEON_H */
@@ -0,0 +1,19 @@
+# SPDX-License-Identifier: GPL-2.0+
+#
+# NEON flags of the host programs, included by tests/ and bench/.
+# 32-bit ARM needs -mfpu=neon, AArch64 has NEON in the base ISA and its
+# compiler rejects -mfpu. Elsewhere the intrinsics are emulated in C.
+
+NEON_MK_DIR := $(dir $(lastword $(MAKEFILE_LIST)))
+NEON_MACHINE := $(shell $(CC) -dumpmachine)
+
+ifneq ($(filter aarch64% arm64%,$(NEON_MACHINE)),)
+NEON_NATIVE := y
+NEON_CFLAGS :=
+else ifneq ($(filter arm%,$(NEON_MACHINE)),)
+NEON_NATIVE := y
+NEON_CFLAGS := -mfpu=neon
+else
+NEON_NATIVE :=
+NEON_CFLAGS := -I$(NEON_MK_DIR)neon-emu
+endif
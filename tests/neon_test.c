@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Cross-checks the NEON dither and packing paths against the scalar ones.
+ * Built natively on ARM, elsewhere st7305-neon.c is compiled against the
+ * lane by lane intrinsics in neon-emu/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+
+#include "dither.h"
+#include "geometry.h"
+
+#define ITERATIONS 2000
+#define MAX_WIDTH 400
+
+static const u8 threshold_types[] = {
+	DITHER_TYPE_NONE,
+	DITHER_TYPE_BAYER_4X4,
+	DITHER_TYPE_BAYER_16X16,
+	DITHER_TYPE_BLUE_NOISE,
+};
+
+static int check_dither(u8 type)
+{
+	u32 xrgb[MAX_WIDTH];
+	u8 gray[MAX_WIDTH], ref[MAX_WIDTH], out[MAX_WIDTH];
+	uint i, k;
+
+	for (i = 0; i < ITERATIONS; i++) {
+		uint x = rand() % 64, y = rand() % 512;
+		uint width = rand() % (MAX_WIDTH + 1);
+
+		for (k = 0; k < width; k++) {
+			xrgb[k] = (u32)rand() << 1 ^ rand();
+			gray[k] = rand();
+		}
+
+		dither_xrgb8888_line_to_bw(type, ref, xrgb, x, y, width);
+		dither_xrgb8888_line_to_bw_neon(type, out, xrgb, x, y, width);
+		if (memcmp(ref, out, width))
+			goto fail;
+
+		dither_gray8_line_to_bw(type, ref, gray, x, y, width);
+		dither_gray8_line_to_bw_neon(type, out, gray, x, y, width);
+		if (memcmp(ref, out, width))
+			goto fail;
+		continue;
+fail:
+		printf("dither %s: x=%u y=%u width=%u: FAIL\n",
+		       dither_get_name(type), x, y, width);
+		return 1;
+	}
+
+	printf("dither %s: ok\n", dither_get_name(type));
+
+	return 0;
+}
+
+static int check_packer(const struct st7305_panel *g)
+{
+	size_t size = g->page_size * g->page_count;
+	u8 *ref = malloc(size);
+	u8 *out = malloc(size);
+	u8 *rows = malloc(g->width * 2);
+	uint i, k;
+	int ret = 0;
+
+	for (i = 0; i < ITERATIONS && !ret; i++) {
+		struct drm_rect clip = { 0, 0, g->width, g->height };
+
+		/* one page, only the columns matter */
+		if (i && !random_clip(g, &clip))
+			continue;
+
+		for (k = 0; k < size; k++)
+			ref[k] = rand();
+		memcpy(out, ref, size);
+		for (k = 0; k < g->width * 2; k++)
+			rows[k] = rand();
+
+		g->packer->pack_page(ref, rows, rows + g->width, clip.x1,
+				     clip.x2, g->left_offset);
+		g->packer->pack_page_neon(out, rows, rows + g->width, clip.x1,
+					  clip.x2, g->left_offset);
+
+		if (memcmp(ref, out, g->page_size)) {
+			printf("pack %s: clip %d-%d: FAIL\n", g->name, clip.x1,
+			       clip.x2);
+			ret = 1;
+		}
+	}
+
+	if (!ret)
+		printf("pack %s: ok\n", g->name);
+
+	free(rows);
+	free(out);
+	free(ref);
+
+	return ret;
+}
+
+int main(void)
+{
+	int ret = 0;
+	uint i;
+
+	srand(1);
+
+	for (i = 0; i < ARRAY_SIZE(threshold_types); i++)
+		ret |= check_dither(threshold_types[i]);
+
+	for (i = 0; i < ARRAY_SIZE(panels); i++)
+		ret |= check_packer(panels[i]);
+
+	return ret;
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-2.0+
+/*
+ * Checks the page packers bit for bit against the per-pixel drawing the
+ * driver started out with, for every panel geometry and random clips
+ * aligned the way st7305_align_clip() does it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <linux/kernel.h>
+#include <linux/string.h>
+
+#include "geometry.h"
+
+#define ITERATIONS 2000
+
+/* The reference, st7305_draw_pixel() and st7306_draw_pixel() of the baseline */
+static void st7305_draw_pixel(u8 *dst, uint x, uint y, u8 left_offset,
+			      u8 page_size, u8 gray)
+{
+	uint new_x = x + left_offset;
+	u32 byte_idx = ((y >> 1) * page_size) + (new_x >> 2);
+	u32 bit_idx = ((new_x & 3) << 1) | (y & 1);
+	u8 mask = BIT(7 - bit_idx);
+	u8 set = (gray >> 7) * mask;
+
+	dst[byte_idx] = (dst[byte_idx] & ~mask) | set;
+}
+
+static void st7306_draw_pixel(u8 *dst, uint x, uint y, u8 left_offset,
+			      u8 page_size, u8 gray)
+{
+	uint new_x = x + left_offset;
+	uint real_x = new_x >> 1;
+	uint real_y = y >> 1;
+	uint byte_idx = real_y * page_size + real_x;
+	uint y_bit = y & 1;
+	uint x_bit = new_x & 1;
+	uint base_bit = (x_bit << 2) + y_bit;
+	u8 mask = BIT(7 - base_bit) | BIT(5 - base_bit);
+	u8 val = dst[byte_idx];
+	u8 on = -(gray >> 7);
+
+	dst[byte_idx] = (val & ~mask) | (on & mask);
+}
+
+static void draw_pixel(const struct st7305_panel *g, u8 *dst, uint x, uint y,
+		       u8 gray)
+{
+	if (g->packer == &st7306_packer)
+		st7306_draw_pixel(dst, x, y, g->left_offset, g->page_size,
+				  gray);
+	else
+		st7305_draw_pixel(dst, x, y, g->left_offset, g->page_size,
+				  gray);
+}
+
+static u8 random_pixel(void)
+{
+	/* Only bit 7 counts, leave noise in the others */
+	return rand() & 0xff;
+}
+
+static int check_geometry(const struct st7305_panel *g)
+{
+	size_t size = g->page_size * g->page_count;
+	u8 *panel = calloc(1, size);
+	u8 *ref = malloc(size);
+	u8 *out = malloc(size);
+	u8 *rows = malloc(g->width * g->height);
+	uint x, y, i;
+	int ret = 0;
+
+	/* RAM bits backing a panel pixel, the padding ones are don't care */
+	for (y = 0; y < g->height; y++)
+		for (x = 0; x < g->width; x++)
+			draw_pixel(g, panel, x, y, 0xff);
+
+	for (i = 0; i < ITERATIONS && !ret; i++) {
+		struct drm_rect clip = { 0, 0, g->width, g->height };
+		size_t b;
+
+		if (i && !random_clip(g, &clip))
+			continue;
+
+		for (b = 0; b < size; b++)
+			ref[b] = rand();
+		memcpy(out, ref, size);
+		for (b = 0; b < g->width * g->height; b++)
+			rows[b] = random_pixel();
+
+		for (y = clip.y1; y < clip.y2; y++)
+			for (x = clip.x1; x < clip.x2; x++)
+				draw_pixel(g, ref, x, y,
+					   rows[y * g->width + x]);
+
+		for (y = clip.y1; y < clip.y2; y += 2)
+			g->packer->pack_page(out + (y >> 1) * g->page_size,
+					     rows + y * g->width + clip.x1,
+					     rows + (y + 1) * g->width + clip.x1,
+					     clip.x1, clip.x2, g->left_offset);
+
+		for (b = 0; b < size; b++) {
+			if (!((ref[b] ^ out[b]) & panel[b]))
+				continue;
+			fprintf(stderr,
+				"%s: clip " DRM_RECT_FMT ": byte %zu is 0x%02x, expected 0x%02x\n",
+				g->name, DRM_RECT_ARG(&clip), b, out[b],
+				ref[b]);
+			ret = 1;
+			break;
+		}
+	}
+
+	printf("%s: %s\n", g->name, ret ? "FAIL" : "ok");
+
+	free(rows);
+	free(out);
+	free(ref);
+	free(panel);
+
+	return ret;
+}
+
+int main(void)
+{
+	int ret = 0;
+	uint i;
+
+	srand(1);
+
+	for (i = 0; i < ARRAY_SIZE(panels); i++)
+		ret |= check_geometry(panels[i]);
+
+	return ret;
+}